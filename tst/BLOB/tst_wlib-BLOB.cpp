@@ -536,3 +536,278 @@ TEST_CASE()
   REQUIRE_THROWS(blob.extract_front<uint32_t>());
   REQUIRE_THROWS(blob.extract_back<uint32_t>());
 }
+
+TEST_CASE()
+{
+  std::byte buffer[12]{};
+
+  wlib::blob::MemoryBlob blob{ buffer };
+
+  REQUIRE(blob.try_insert_back(std::endian::big, static_cast<uint8_t>(0x01), static_cast<uint16_t>(0x0203), static_cast<uint32_t>(0x0405'0607)));
+  REQUIRE(blob.get_number_of_used_bytes() == 7);
+
+  REQUIRE_FALSE(blob.try_insert_back(std::endian::little, static_cast<uint32_t>(0), static_cast<uint16_t>(0)));
+  REQUIRE(blob.get_number_of_used_bytes() == 7);
+
+  blob.insert_back(std::endian::little, static_cast<uint16_t>(0x0908), static_cast<std::byte>(0x0A));
+  REQUIRE(blob.get_number_of_used_bytes() == 10);
+  REQUIRE_THROWS(blob.insert_back(std::endian::little, static_cast<uint16_t>(0), static_cast<uint8_t>(0)));
+  REQUIRE(blob.get_number_of_used_bytes() == 10);
+
+  for (std::size_t i = 0; i < 10; i++)
+  {
+    REQUIRE(buffer[i] == std::byte(i + 1));
+  }
+
+  uint8_t   val_1 = 0;
+  uint16_t  val_2 = 0;
+  uint32_t  val_3 = 0;
+  uint16_t  val_4 = 0;
+  std::byte val_5{};
+  REQUIRE(blob.try_read(0, std::endian::big, val_1, val_2, val_3));
+  REQUIRE(val_1 == 0x01);
+  REQUIRE(val_2 == 0x0203);
+  REQUIRE(val_3 == 0x0405'0607);
+
+  blob.read(7, std::endian::little, val_4, val_5);
+  REQUIRE(val_4 == 0x0908);
+  REQUIRE(val_5 == std::byte(0x0A));
+
+  REQUIRE_FALSE(blob.try_read(4, std::endian::big, val_3, val_2, val_1));
+  REQUIRE_THROWS(blob.read(8, std::endian::big, val_2, val_1));
+}
+
+TEST_CASE()
+{
+  static_assert(wlib::blob::byteswap(static_cast<uint16_t>(0x0102)) == 0x0201);
+  static_assert(wlib::blob::byteswap(static_cast<uint32_t>(0x0102'0304)) == 0x0403'0201);
+  static_assert(wlib::blob::byteswap(static_cast<uint64_t>(0x0102'0304'0506'0708)) == 0x0807'0605'0403'0201);
+  static_assert(wlib::blob::byteswap(std::byte(0x01)) == std::byte(0x01));
+
+  std::byte buffer[14]{};
+
+  wlib::blob::MemoryBlob blob{ buffer };
+
+  REQUIRE_THROWS(blob.insert<uint16_t, std::endian::big>(1, 0));
+  REQUIRE(blob.get_number_of_used_bytes() == 0);
+
+  blob.insert_back<uint32_t, std::endian::big>(0x00AA'BBEF);
+  blob.insert_front<uint32_t, std::endian::big>(0xDECC'DDAD);
+  blob.insert<uint16_t, std::endian::big>(4, 0xBE00);
+  REQUIRE(blob.get_number_of_used_bytes() == 10);
+
+  REQUIRE(blob.read<uint16_t, std::endian::little>(1) == 0xDDCC);
+  REQUIRE(blob.read<uint16_t>(1, std::endian::little) == 0xDDCC);
+  REQUIRE(blob.read_back<uint32_t, std::endian::big>() == 0x00AA'BBEF);
+  REQUIRE(blob.read_front<uint32_t, std::endian::little>() == 0xADDD'CCDE);
+
+  blob.overwrite<uint16_t, std::endian::big>(1, 0xCCDD);
+  blob.overwrite_back<uint16_t, std::endian::little>(0xEFBB);
+  blob.overwrite_front<uint8_t, std::endian::big>(0xDE);
+  REQUIRE_THROWS(blob.overwrite<uint32_t, std::endian::big>(7, 0));
+
+  REQUIRE(blob.extract<uint16_t, std::endian::little>(1) == 0xDDCC);
+  REQUIRE(blob.extract<uint32_t, std::endian::big>(3) == 0x0000'AABB);
+  REQUIRE(blob.extract_front<uint32_t, std::endian::big>() == 0xDEADBEEF);
+  REQUIRE(blob.get_number_of_used_bytes() == 0);
+  REQUIRE_THROWS(blob.extract_back<uint8_t, std::endian::big>());
+
+  REQUIRE(blob.try_insert_back<double, std::endian::big>(1.5));
+  double val = 0;
+  REQUIRE(blob.try_read_front<double, std::endian::big>(val));
+  REQUIRE(val == 1.5);
+  REQUIRE(blob.read<double>(0, std::endian::big) == 1.5);
+  REQUIRE(buffer[0] == std::byte(0x3F));
+  REQUIRE(blob.try_extract_back<double, std::endian::big>(val));
+  REQUIRE(blob.get_number_of_used_bytes() == 0);
+}
+
+TEMPLATE_TEST_CASE("bulk typed access", "", uint8_t, uint16_t, int32_t, uint64_t, float, double, long double)
+{
+  constexpr std::size_t number_of_elements = 37;
+
+  std::byte buffer[number_of_elements * sizeof(TestType) + 1]{};
+
+  TestType val_in[number_of_elements]{};
+  for (std::size_t i = 0; i < number_of_elements; i++)
+    val_in[i] = static_cast<TestType>(i * 3 + 1);
+
+  for (std::endian endian : { std::endian::little, std::endian::big })
+  {
+    wlib::blob::MemoryBlob blob{ buffer };
+    REQUIRE(blob.try_insert_back(std::endian::big, static_cast<uint8_t>(0xAA)));
+    REQUIRE(blob.try_insert_back(std::span<TestType const>(val_in), endian));
+    REQUIRE(blob.get_number_of_free_bytes() == 0);
+    REQUIRE_FALSE(blob.try_insert_back(std::span<TestType const>(val_in).first(1), endian));
+
+    for (std::size_t i = 0; i < number_of_elements; i++)
+    {
+      REQUIRE(blob.read<TestType>(1 + i * sizeof(TestType), endian) == val_in[i]);
+    }
+
+    TestType val_out[number_of_elements]{};
+    REQUIRE(blob.try_read(1, std::span<TestType>(val_out), endian));
+    for (std::size_t i = 0; i < number_of_elements; i++)
+    {
+      REQUIRE(val_out[i] == val_in[i]);
+    }
+    REQUIRE_THROWS(blob.read(2, std::span<TestType>(val_out), endian));
+
+    blob.overwrite(1, std::span<TestType const>(val_in).subspan(1), endian);
+    REQUIRE(blob.read<TestType>(1, endian) == val_in[1]);
+    REQUIRE_THROWS(blob.overwrite(2, std::span<TestType const>(val_in), endian));
+  }
+}
+
+TEST_CASE()
+{
+  using blob_t = wlib::blob::StaticBlob<14>;
+  static_assert(std::is_trivially_copyable_v<blob_t>);
+  static_assert(std::is_trivially_copyable_v<wlib::blob::MemoryBlob>);
+
+  constexpr blob_t empty_blob{};
+  static_assert(empty_blob.get_total_number_of_bytes() == 14);
+  static_assert(empty_blob.get_number_of_free_bytes() == 14);
+  static_assert(empty_blob.get_number_of_used_bytes() == 0);
+
+  blob_t blob;
+  REQUIRE_THROWS(blob.insert(1, static_cast<uint16_t>(0), std::endian::big));
+
+  blob.insert_back(static_cast<uint32_t>(0x00AA'BBEF), std::endian::big);
+  blob.insert_front<uint32_t, std::endian::big>(0xDECC'DDAD);
+  blob.insert(4, static_cast<uint16_t>(0xBE00), std::endian::big);
+  REQUIRE(blob.get_number_of_used_bytes() == 10);
+  REQUIRE(blob.get_number_of_free_bytes() == 4);
+
+  blob_t const copy = blob;
+  REQUIRE(copy.get_number_of_used_bytes() == 10);
+  REQUIRE(copy.get_blob().data() != blob.get_blob().data());
+
+  REQUIRE(blob.extract<uint16_t>(1, std::endian::little) == 0xDDCC);
+  REQUIRE(blob.extract<uint32_t>(3, std::endian::big) == 0x0000'AABB);
+  REQUIRE(blob.extract_front<uint32_t>(std::endian::big) == 0xDEADBEEF);
+  REQUIRE(blob.get_number_of_used_bytes() == 0);
+
+  REQUIRE(copy.read_front<uint32_t, std::endian::big>() == 0xDECC'DDAD);
+  REQUIRE(copy.read_back<uint32_t>(std::endian::big) == 0x00AA'BBEF);
+  REQUIRE_FALSE(blob.try_insert_back(std::span<uint64_t const>(std::array<uint64_t, 2>{}), std::endian::big));
+}
+
+namespace
+{
+  constexpr wlib::blob::StaticBlob<16> make_frame()
+  {
+    wlib::blob::StaticBlob<16> blob;
+    blob.insert_back(std::endian::big, static_cast<uint16_t>(0x0102), static_cast<uint32_t>(0x0304'0506));
+    blob.insert_front<uint8_t, std::endian::big>(0x7E);
+    blob.insert_back(std::span<uint16_t const>(std::array<uint16_t, 2>{0x0708, 0x090A}), std::endian::little);
+    blob.overwrite(1, static_cast<uint16_t>(0xCAFE), std::endian::big);
+    blob.remove(3, 2);
+    blob.insert_back(1.5f);
+    return blob;
+  }
+}    // namespace
+
+TEST_CASE()
+{
+  static constexpr wlib::blob::StaticBlob<16> frame = make_frame();
+  static_assert(frame.get_number_of_used_bytes() == 13);
+  static_assert(frame.read_front<uint8_t>() == 0x7E);
+  static_assert(frame.read<uint16_t, std::endian::big>(1) == 0xCAFE);
+  static_assert(frame.read<uint16_t>(3, std::endian::big) == 0x0506);
+  static_assert(frame.read<uint32_t>(4, std::endian::little) == 0x0A07'0806);
+  static_assert(frame.read_back<float>() == 1.5f);
+
+  wlib::blob::StaticBlob<16> blob = frame;
+  REQUIRE(blob.extract_back<float>() == 1.5f);
+
+  uint16_t values[2]{};
+  blob.read(5, std::span<uint16_t>(values), std::endian::little);
+  REQUIRE(values[0] == 0x0708);
+  REQUIRE(values[1] == 0x090A);
+}
+
+namespace
+{
+  template <typename T> concept can_insert    = requires(T& blob) { blob.insert_back(std::byte(0)); };
+  template <typename T> concept can_remove    = requires(T& blob) { blob.remove_front(1); };
+  template <typename T> concept can_overwrite = requires(T& blob) { blob.overwrite(0, std::byte(0)); };
+}    // namespace
+
+TEST_CASE()
+{
+  std::byte              buffer[16]{};
+  wlib::blob::MemoryBlob blob(buffer);
+  blob.insert_back(std::endian::big, static_cast<uint16_t>(0x7E08), static_cast<uint8_t>(0x01), static_cast<uint32_t>(0xCAFE'BABE), static_cast<uint16_t>(0xAA55));
+
+  wlib::blob::BlobView payload = blob.subblob(2, 5);
+  REQUIRE(payload.get_number_of_used_bytes() == 5);
+  REQUIRE(payload.get_blob().data() == &buffer[2]);
+  REQUIRE(payload.read_front<uint8_t>() == 0x01);
+  REQUIRE(payload.read_back<uint32_t>(std::endian::big) == 0xCAFE'BABE);
+  REQUIRE_THROWS(payload.read<uint16_t>(4));
+
+  payload.overwrite<uint16_t, std::endian::big>(1, 0xF00D);
+  REQUIRE(blob.read<uint32_t>(3, std::endian::big) == 0xF00D'BABE);
+  REQUIRE_FALSE(payload.try_overwrite(4, static_cast<uint16_t>(0)));
+
+  wlib::blob::ConstBlobView const inner = wlib::blob::ConstBlobView(payload).subblob(3, 2);
+  REQUIRE(inner.read_front<uint16_t>(std::endian::big) == 0xBABE);
+  REQUIRE(inner.get_blob().data() == &buffer[5]);
+
+  wlib::blob::MemoryBlob const& const_blob = blob;
+  wlib::blob::ConstBlobView     view;
+  REQUIRE(const_blob.try_subblob(7, 2, view));
+  REQUIRE(view.read_front<uint16_t>(std::endian::big) == 0xAA55);
+  REQUIRE_FALSE(const_blob.try_subblob(7, 3, view));
+  REQUIRE_THROWS(blob.subblob(10, 0));
+
+  static_assert(!can_insert<wlib::blob::BlobView>);
+  static_assert(!can_remove<wlib::blob::BlobView>);
+  static_assert(!can_overwrite<wlib::blob::ConstBlobView>);
+  static_assert(can_overwrite<wlib::blob::BlobView>);
+}
+
+TEST_CASE("aligned typed views")
+{
+  wlib::blob::StaticBlob<64, 32> blob;
+  REQUIRE((reinterpret_cast<std::uintptr_t>(blob.get_blob().data()) % 32) == 0);
+  static_assert(alignof(wlib::blob::StaticBlob<64, 32>) == 32);
+  for (uint32_t idx = 0; idx < 8; idx++)
+    blob.insert_back(idx * 3);
+  blob.insert_back(uint8_t{ 0xFF });
+
+  std::span<uint32_t const> values = blob.as_span<uint32_t>(4, 7);
+  REQUIRE(values.data() == reinterpret_cast<uint32_t const*>(blob.get_blob().data() + 4));
+  REQUIRE(values[6] == 21);
+  REQUIRE_THROWS(blob.as_span<uint32_t>(4, 8));
+  REQUIRE_THROWS(blob.as_span<uint32_t>(2, 1));
+  REQUIRE(blob.as_span<uint32_t>(32, 0).empty());
+
+  // Processed in place through the mutable view.
+  std::span<uint32_t> writable;
+  REQUIRE(blob.try_as_span(0, 8, writable));
+  for (uint32_t& value : writable)
+    value += 1;
+  REQUIRE(blob.read<uint32_t>(28) == 22);
+  REQUIRE_FALSE(blob.try_as_span(1, 2, writable));
+  REQUIRE_FALSE(blob.try_as_span(30, 2, writable));
+
+  // Misaligned data is copied into the buffer instead.
+  std::array<uint16_t, 4> buffer{};
+  std::span<uint16_t const> const copied = blob.as_span<uint16_t>(1, 3, buffer);
+  REQUIRE(copied.data() == buffer.data());
+  REQUIRE(copied.size() == 3);
+  REQUIRE(copied[0] == blob.read<uint16_t>(1));
+  REQUIRE(copied[2] == blob.read<uint16_t>(5));
+  REQUIRE(blob.as_span<uint16_t>(2, 4, buffer).data() != buffer.data());
+  REQUIRE_THROWS(blob.as_span<uint16_t>(1, 5, buffer));
+  REQUIRE_THROWS(blob.as_span<uint16_t>(31, 2, buffer));
+
+  wlib::blob::ConstBlobView const view = blob.subblob(8, 8);
+  std::span<uint32_t const>       inner;
+  REQUIRE(view.try_as_span(0, 2, inner));
+  REQUIRE(inner[1] == 10);
+  REQUIRE(view.as_span<uint64_t>(0, 1).size() == 1);
+  REQUIRE_FALSE(view.try_as_span(4, 2, inner));
+}
@@ -0,0 +1,89 @@
+#include <ut_catch.hpp>
+#include <wlib-BLOB_Batch.hpp>
+
+#include <random>
+#include <vector>
+
+namespace
+{
+  std::span<std::byte const> as_bytes(char const* text) noexcept { return std::as_bytes(std::span<char const>(text, std::strlen(text))); }
+}    // namespace
+
+TEST_CASE("batched edits")
+{
+  wlib::blob::StaticBlob<32> blob;
+  blob.insert_back(as_bytes("0123456789").data(), 10);
+
+  wlib::blob::blob_edit const edits[]{
+    wlib::blob::blob_edit::insert(0, as_bytes("<<")),
+    wlib::blob::blob_edit::remove(2, 3),
+    wlib::blob::blob_edit::replace(6, 1, as_bytes("abc")),
+    wlib::blob::blob_edit::insert(7, as_bytes("")),
+    wlib::blob::blob_edit::insert(10, as_bytes(">")),
+  };
+  std::size_t size = 0;
+  REQUIRE(wlib::blob::try_measure_edits(10, edits, size));
+  REQUIRE(size == 12);
+  wlib::blob::edit(blob, edits);
+  REQUIRE(std::string_view(reinterpret_cast<char const*>(blob.get_blob().data()), blob.get_number_of_used_bytes()) == "<<015abc789>");
+
+  // Rejected batches leave the blob untouched.
+  wlib::blob::blob_edit const unsorted[]{ wlib::blob::blob_edit::remove(5, 1), wlib::blob::blob_edit::remove(4, 1) };
+  wlib::blob::blob_edit const overlapping[]{ wlib::blob::blob_edit::remove(4, 2), wlib::blob::blob_edit::insert(5, as_bytes("x")) };
+  wlib::blob::blob_edit const outside[]{ wlib::blob::blob_edit::remove(11, 2) };
+  std::vector<std::byte> const large(22);
+  wlib::blob::blob_edit const too_large[]{ wlib::blob::blob_edit::remove(0, 1), wlib::blob::blob_edit::insert(12, large) };
+  REQUIRE_FALSE(wlib::blob::try_edit(blob, unsorted));
+  REQUIRE_FALSE(wlib::blob::try_edit(blob, overlapping));
+  REQUIRE_FALSE(wlib::blob::try_edit(blob, outside));
+  REQUIRE_FALSE(wlib::blob::try_edit(blob, too_large));
+  REQUIRE_THROWS(wlib::blob::edit(blob, too_large));
+  REQUIRE(std::string_view(reinterpret_cast<char const*>(blob.get_blob().data()), blob.get_number_of_used_bytes()) == "<<015abc789>");
+
+  wlib::blob::edit(blob, std::span<wlib::blob::blob_edit const>());
+  REQUIRE(blob.get_number_of_used_bytes() == 12);
+  wlib::blob::blob_edit const everything[]{ wlib::blob::blob_edit::remove(0, 12) };
+  wlib::blob::edit(blob, everything);
+  REQUIRE(blob.get_number_of_used_bytes() == 0);
+}
+
+TEST_CASE("batched edits match single edits")
+{
+  std::mt19937 rng(49);
+  for (int round = 0; round < 500; round++)
+  {
+    std::size_t const      used = rng() % 200;
+    std::vector<std::byte> raw(512);
+    for (std::byte& value : raw)
+      value = static_cast<std::byte>(rng());
+    wlib::blob::MemoryBlob batched(raw.data(), raw.size(), used);
+    std::vector<std::byte> expected(raw.begin(), raw.begin() + static_cast<std::ptrdiff_t>(used));
+
+    std::vector<std::vector<std::byte>> payloads;
+    std::vector<wlib::blob::blob_edit>  edits;
+    std::size_t                         offset = 0;
+    while (offset < used && edits.size() < 12)
+    {
+      offset += rng() % (used / 4 + 1);
+      if (used < offset)
+        break;
+      std::vector<std::byte>& payload = payloads.emplace_back(rng() % 24, static_cast<std::byte>(edits.size()));
+      std::size_t const       removed = (rng() % 3 == 0) ? 0 : (rng() % (used - offset + 1)) % 20;
+      edits.push_back(wlib::blob::blob_edit::replace(offset, removed, std::span<std::byte const>(payloads.back().data(), payload.size())));
+      offset += removed;
+    }
+
+    // Applied back to front the original offsets stay valid.
+    for (std::size_t idx = edits.size(); idx != 0; idx--)
+    {
+      wlib::blob::blob_edit const& edit  = edits[idx - 1];
+      auto const                   begin = expected.begin() + static_cast<std::ptrdiff_t>(edit.offset);
+      expected.erase(begin, begin + static_cast<std::ptrdiff_t>(edit.number_of_removed_bytes));
+      expected.insert(expected.begin() + static_cast<std::ptrdiff_t>(edit.offset), edit.data.begin(), edit.data.end());
+    }
+
+    REQUIRE(wlib::blob::try_edit(batched, edits));
+    REQUIRE(batched.get_number_of_used_bytes() == expected.size());
+    REQUIRE(std::equal(expected.begin(), expected.end(), raw.begin()));
+  }
+}
@@ -0,0 +1,125 @@
+#include <ut_catch.hpp>
+#include <wlib-BLOB_Bits.hpp>
+
+#include <vector>
+
+namespace
+{
+  struct field_t
+  {
+    uint64_t    value;
+    std::size_t number_of_bits;
+  };
+
+  std::vector<field_t> make_fields()
+  {
+    std::vector<field_t> fields;
+    uint64_t             state = 0x0123'4567'89AB'CDEF;
+    for (std::size_t i = 0; i < 300; i++)
+    {
+      state ^= state << 13;
+      state ^= state >> 7;
+      state ^= state << 17;
+      fields.push_back({ state, (i < 64) ? (i + 1) : ((state >> 58) + 1) });
+    }
+    return fields;
+  }
+
+  template <wlib::blob::bit_order order> std::vector<std::byte> reference_packing(std::vector<field_t> const& fields)
+  {
+    std::vector<std::byte> bytes;
+    std::size_t            bit_idx = 0;
+    for (field_t const& field : fields)
+    {
+      for (std::size_t i = 0; i < field.number_of_bits; i++, bit_idx++)
+      {
+        if ((bit_idx % 8) == 0)
+          bytes.push_back(std::byte(0));
+        std::size_t const src_bit = (order == wlib::blob::bit_order::msb_first) ? (field.number_of_bits - 1 - i) : i;
+        std::size_t const dst_bit = (order == wlib::blob::bit_order::msb_first) ? (7 - bit_idx % 8) : (bit_idx % 8);
+        if ((field.value >> src_bit) & 1)
+          bytes.back() |= std::byte(1 << dst_bit);
+      }
+    }
+    return bytes;
+  }
+
+  template <wlib::blob::bit_order order> void check_roundtrip()
+  {
+    std::vector<field_t> const   fields   = make_fields();
+    std::vector<std::byte> const expected = reference_packing<order>(fields);
+
+    std::vector<std::byte> buffer(expected.size() + 3);
+    wlib::blob::MemoryBlob blob(buffer.data(), buffer.size());
+
+    wlib::blob::BitWriter<wlib::blob::MemoryBlob, order> writer(blob);
+    for (field_t const& field : fields)
+      writer.write_bits(field.value, field.number_of_bits);
+    writer.flush();
+    REQUIRE(writer.get_number_of_pending_bits() == 0);
+    REQUIRE(blob.get_number_of_used_bytes() == expected.size());
+    for (std::size_t i = 0; i < expected.size(); i++)
+      REQUIRE(buffer[i] == expected[i]);
+
+    wlib::blob::BitReader<wlib::blob::MemoryBlob, order> reader(blob);
+    for (field_t const& field : fields)
+      REQUIRE(reader.read_bits(field.number_of_bits) == (field.value & wlib::blob::bits::mask(field.number_of_bits)));
+    REQUIRE(reader.get_number_of_remaining_bits() < 8);
+  }
+}    // namespace
+
+TEST_CASE("bit writer and reader byte layout")
+{
+  wlib::blob::StaticBlob<8> blob;
+
+  wlib::blob::BitWriter msb_writer(blob);
+  msb_writer.write_bits(0b101, 3);
+  msb_writer.write_bits(0b00011, 5);
+  msb_writer.write_bits(0xF, 4);
+  REQUIRE(msb_writer.get_number_of_pending_bits() == 12);
+  REQUIRE(blob.get_number_of_used_bytes() == 0);
+  msb_writer.flush();
+  REQUIRE(blob.read_front<uint16_t>(std::endian::big) == 0xA3F0);
+
+  wlib::blob::BitWriter<wlib::blob::StaticBlob<8>, wlib::blob::bit_order::lsb_first> lsb_writer(blob);
+  lsb_writer.write_bits(0b101, 3);
+  lsb_writer.write_bits(0b00011, 5);
+  lsb_writer.write_bits(0xF, 4);
+  lsb_writer.flush();
+  REQUIRE(blob.read<uint16_t>(2, std::endian::big) == 0x1D0F);
+
+  wlib::blob::BitReader msb_reader(blob);
+  REQUIRE(msb_reader.read_bits(3) == 0b101);
+  msb_reader.align();
+  REQUIRE(msb_reader.read_bits(4) == 0xF);
+  REQUIRE(msb_reader.get_number_of_remaining_bits() == 20);
+
+  wlib::blob::BitReader<wlib::blob::StaticBlob<8>, wlib::blob::bit_order::lsb_first> lsb_reader(blob, 2);
+  REQUIRE(lsb_reader.read_bits(3) == 0b101);
+  REQUIRE(lsb_reader.read_bits(9) == 0x1E3);
+  REQUIRE_THROWS(lsb_reader.read_bits(5));
+  uint64_t value = 0;
+  REQUIRE(lsb_reader.try_read_bits(value, 4));
+  REQUIRE(value == 0);
+}
+
+TEST_CASE("bit writer and reader roundtrip")
+{
+  check_roundtrip<wlib::blob::bit_order::msb_first>();
+  check_roundtrip<wlib::blob::bit_order::lsb_first>();
+}
+
+TEST_CASE("bit writer capacity")
+{
+  wlib::blob::StaticBlob<9> blob;
+  wlib::blob::BitWriter     writer(blob);
+  writer.write_bits(~uint64_t(0), 64);
+  REQUIRE(blob.get_number_of_used_bytes() == 8);
+
+  writer.write_bits(0x1FF, 9);
+  REQUIRE_FALSE(writer.try_write_bits(0, 64));
+  REQUIRE(writer.get_number_of_pending_bits() == 9);
+  REQUIRE_THROWS(writer.flush());
+  REQUIRE(writer.get_number_of_pending_bits() == 9);
+  REQUIRE_FALSE(writer.try_write_bits(0, 65));
+}
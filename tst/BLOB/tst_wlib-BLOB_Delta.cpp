@@ -0,0 +1,70 @@
+#include <ut_catch.hpp>
+#include <wlib-BLOB_Delta.hpp>
+
+#include <random>
+#include <vector>
+
+TEST_CASE("delta between blob versions")
+{
+  std::mt19937           rng(11);
+  std::vector<std::byte> previous_raw(4096);
+  for (std::byte& value : previous_raw)
+    value = static_cast<std::byte>(rng());
+  std::vector<std::byte> current_raw = previous_raw;
+
+  wlib::blob::MemoryBlob previous(previous_raw.data(), previous_raw.size(), previous_raw.size());
+  wlib::blob::MemoryBlob current(current_raw.data(), current_raw.size(), current_raw.size());
+  current.overwrite<uint32_t>(100, 0xDEAD'BEEF);
+  current.overwrite<uint8_t>(3000, static_cast<uint8_t>(~current.read<uint8_t>(3000)));
+  current.overwrite<uint16_t>(4094, 0x1234);
+
+  wlib::blob::StaticBlob<128> delta;
+  wlib::blob::delta::encode_back(delta, previous.get_blob(), current.get_blob());
+  REQUIRE(delta.get_number_of_used_bytes() < 48);
+
+  wlib::blob::delta::apply(previous, delta.get_blob());
+  REQUIRE(previous_raw == current_raw);
+
+  delta.clear();
+  wlib::blob::delta::encode_back(delta, previous.get_blob(), current.get_blob());
+  REQUIRE(delta.get_number_of_used_bytes() == 2);
+
+  wlib::blob::StaticBlob<8> small;
+  REQUIRE_FALSE(wlib::blob::delta::try_encode_back(small, std::span<std::byte const>(), current.get_blob()));
+  REQUIRE(small.get_number_of_used_bytes() == 0);
+}
+
+TEST_CASE("delta with size changes and random edits")
+{
+  std::mt19937 rng(12);
+  for (int round = 0; round < 50; round++)
+  {
+    std::vector<std::byte> previous_raw(rng() % 300);
+    for (std::byte& value : previous_raw)
+      value = static_cast<std::byte>(rng() % 4);
+    std::vector<std::byte> current_raw = previous_raw;
+    current_raw.resize(rng() % 300, std::byte(0x5A));
+    for (std::size_t edits = rng() % 10; edits != 0 && !current_raw.empty(); edits--)
+      current_raw[rng() % current_raw.size()] = static_cast<std::byte>(rng());
+
+    std::vector<std::byte> delta_raw(wlib::blob::delta::max_encoded_size(current_raw.size()));
+    wlib::blob::MemoryBlob delta(delta_raw.data(), delta_raw.size());
+    wlib::blob::delta::encode_back(delta, previous_raw, current_raw);
+
+    std::vector<std::byte> target_raw(300);
+    wlib::blob::MemoryBlob target(target_raw.data(), target_raw.size());
+    target.insert_back(std::span<std::byte const>(previous_raw));
+    wlib::blob::delta::apply(target, delta.get_blob());
+    REQUIRE(target.get_number_of_used_bytes() == current_raw.size());
+    REQUIRE(std::vector<std::byte>(target.get_blob().begin(), target.get_blob().end()) == current_raw);
+  }
+
+  wlib::blob::StaticBlob<16> target;
+  std::array<std::byte, 4> const truncated{ std::byte(8), std::byte(0), std::byte(4), std::byte(1) };
+  std::array<std::byte, 4> const too_large{ std::byte(17), std::byte(0), std::byte(1), std::byte(1) };
+  std::array<std::byte, 4> const out_of_range{ std::byte(4), std::byte(3), std::byte(2), std::byte(1) };
+  REQUIRE_FALSE(wlib::blob::delta::try_apply(target, truncated));
+  REQUIRE_FALSE(wlib::blob::delta::try_apply(target, too_large));
+  REQUIRE_THROWS(wlib::blob::delta::apply(target, out_of_range));
+  REQUIRE(target.get_number_of_used_bytes() == 0);
+}
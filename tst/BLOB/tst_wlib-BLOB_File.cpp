@@ -0,0 +1,56 @@
+#include <ut_catch.hpp>
+#include <wlib-BLOB_File.hpp>
+
+#if defined(WLIB_BLOB_FILE_MAPPING)
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+
+TEST_CASE("file blob mapping")
+{
+  std::filesystem::path const path = std::filesystem::temp_directory_path() / "tst_wlib-BLOB_File.bin";
+  {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    for (uint32_t i = 0; i < 4096; i++)
+      file.write(reinterpret_cast<char const*>(&i), sizeof(i));
+  }
+
+  wlib::blob::FileBlob blob;
+  REQUIRE_FALSE(blob.is_open());
+  REQUIRE_THROWS_AS(blob.open("/nonexistent/tst_wlib-BLOB_File.bin"), std::system_error);
+
+  blob.open(path.c_str(), wlib::blob::file_access::read_only, { .populate = true, .huge_pages = true });
+  REQUIRE(blob.is_open());
+  REQUIRE(blob.get_number_of_bytes() == 4096 * 4);
+  REQUIRE(blob.try_advise(wlib::blob::file_advice::sequential));
+  REQUIRE(blob.get_view().read<uint32_t>(4 * 1234) == 1234);
+  REQUIRE(blob.get_view().subblob(4 * 4000, 8).read_back<uint32_t>() == 4001);
+  REQUIRE(blob.get_writable_view().get_number_of_used_bytes() == 0);
+  REQUIRE_FALSE(blob.try_advise(4, 4096 * 4, wlib::blob::file_advice::random));
+
+  blob.open(path.c_str(), wlib::blob::file_access::read_write);
+  wlib::blob::BlobView view = blob.get_writable_view();
+  view.overwrite<uint32_t, std::endian::big>(8, 0xCAFE'BABE);
+  REQUIRE(blob.try_sync(8, 4));
+  blob.sync(false);
+
+  wlib::blob::FileBlob moved(std::move(blob));
+  REQUIRE_FALSE(blob.is_open());
+  REQUIRE(moved.get_view().read<uint32_t>(8, std::endian::big) == 0xCAFE'BABE);
+  moved.close();
+
+  {
+    std::ifstream file(path, std::ios::binary);
+    uint32_t      values[3]{};
+    file.read(reinterpret_cast<char*>(values), sizeof(values));
+    REQUIRE(values[1] == 1);
+    REQUIRE(values[2] == 0xBEBA'FECA);
+  }
+
+  std::filesystem::resize_file(path, 0);
+  REQUIRE(blob.try_open(path.c_str()));
+  REQUIRE(blob.get_view().get_number_of_used_bytes() == 0);
+  blob.close();
+  std::filesystem::remove(path);
+}
+#endif
@@ -0,0 +1,74 @@
+#include <ut_catch.hpp>
+#include <wlib-BLOB_Frame.hpp>
+#include <wlib-CRC_16_ccitt.hpp>
+#include <wlib-CRC_32.hpp>
+
+#include <string_view>
+
+namespace
+{
+  constexpr std::string_view check_input = "123456789";
+
+  std::span<std::byte const> as_bytes(std::string_view const& text) { return { reinterpret_cast<std::byte const*>(text.data()), text.size() }; }
+}    // namespace
+
+TEST_CASE("frame builder with big endian length and crc 32")
+{
+  using format_t = wlib::blob::frame_format<uint16_t, uint32_t>;
+
+  wlib::blob::StaticBlob<32> blob;
+  wlib::crc::CRC_32          crc;
+  blob.insert_back(std::byte(0x7E));
+
+  wlib::blob::FrameBuilder<format_t, wlib::blob::StaticBlob<32>> builder(blob, crc);
+  REQUIRE_FALSE(builder.try_commit());
+  builder.begin();
+  REQUIRE(builder.is_open());
+  REQUIRE_FALSE(builder.try_begin());
+  builder.insert_back(as_bytes(check_input).first(4));
+  builder.insert_back<uint8_t, std::endian::big>('5');
+  REQUIRE(builder.try_insert_back(as_bytes(check_input).subspan(5)));
+  REQUIRE(builder.get_number_of_payload_bytes() == 9);
+  REQUIRE(builder.get_number_of_free_bytes() == 32 - 1 - 2 - 9 - 4);
+  builder.commit();
+  REQUIRE_FALSE(builder.is_open());
+
+  REQUIRE(blob.get_number_of_used_bytes() == 1 + 2 + 9 + 4);
+  REQUIRE(blob.read<uint16_t>(1, std::endian::big) == 9);
+  REQUIRE(blob.read<uint8_t>(3) == '1');
+  REQUIRE(blob.read_back<uint32_t>(std::endian::big) == 0xCBF4'3926);
+}
+
+TEST_CASE("frame builder with frame scope and little endian fields")
+{
+  using format_t = wlib::blob::frame_format<uint8_t, uint16_t, std::endian::little, std::endian::big, wlib::blob::length_scope::frame>;
+
+  std::byte                     raw[16];
+  wlib::blob::MemoryBlob        blob(raw);
+  wlib::crc::CRC_16_ccitt_false crc;
+
+  wlib::blob::FrameBuilder<format_t, wlib::blob::MemoryBlob> builder(blob, crc);
+  builder.begin();
+  REQUIRE(builder.get_number_of_free_bytes() == 13);
+  REQUIRE(builder.try_insert_back(as_bytes(check_input)));
+  builder.insert_back(static_cast<uint32_t>(0), std::endian::little);
+  REQUIRE_FALSE(builder.try_insert_back(std::byte(0)));
+  REQUIRE_THROWS(builder.insert_back(std::byte(0)));
+  builder.abort();
+  REQUIRE(blob.get_number_of_used_bytes() == 0);
+
+  REQUIRE(builder.try_begin());
+  builder.insert_back(as_bytes(check_input));
+  REQUIRE(builder.try_commit());
+  REQUIRE(blob.get_number_of_used_bytes() == 12);
+  REQUIRE(blob.read_front<uint8_t>() == 12);
+  REQUIRE(blob.read_back<uint16_t>(std::endian::big) == 0x29B1);
+
+  builder.begin();
+  REQUIRE(builder.get_number_of_free_bytes() == 1);
+  builder.abort();
+  REQUIRE(blob.get_number_of_used_bytes() == 12);
+  blob.insert_back(static_cast<uint16_t>(0));
+  REQUIRE_FALSE(builder.try_begin());
+  REQUIRE_THROWS(builder.commit());
+}
@@ -0,0 +1,129 @@
+#include <ut_catch.hpp>
+#include <wlib-BLOB_IO.hpp>
+
+#if defined(WLIB_BLOB_FILE_MAPPING)
+#include <cerrno>
+#include <filesystem>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+TEST_CASE("vectored file write and read")
+{
+  std::filesystem::path const path = std::filesystem::temp_directory_path() / "tst_wlib-BLOB_IO.bin";
+  int const                   fd   = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+  REQUIRE(fd >= 0);
+
+  wlib::blob::StaticBlob<8> header;
+  header.insert_back<uint32_t, std::endian::big>(0x4652'4D31);
+  std::vector<std::byte> payload(1000);
+  for (std::size_t i = 0; i < payload.size(); i++)
+    payload[i] = static_cast<std::byte>(i);
+  wlib::blob::StaticBlob<4> trailer;
+  trailer.insert_back<uint16_t, std::endian::big>(0xBEEF);
+
+  REQUIRE(wlib::blob::io::try_write(fd, header, payload, trailer));
+  wlib::blob::io::pwrite(fd, 2, trailer);
+
+  REQUIRE(::lseek(fd, 0, SEEK_SET) == 0);
+  wlib::blob::StaticBlob<4>   head;
+  wlib::blob::StaticBlob<512> body;
+  wlib::blob::StaticBlob<600> rest;
+  rest.insert_back(std::byte(0x11));
+  std::size_t number_of_bytes = 0;
+  REQUIRE(wlib::blob::io::try_read(fd, number_of_bytes, head, body, rest));
+  REQUIRE(number_of_bytes == 4 + 1000 + 2);
+  REQUIRE(head.read_front<uint32_t>(std::endian::big) == 0x4652'BEEF);
+  REQUIRE(body.get_number_of_free_bytes() == 0);
+  REQUIRE(body.read<uint8_t>(511) == 255);
+  REQUIRE(rest.get_number_of_used_bytes() == 1 + 488 + 2);
+  REQUIRE(rest.read<uint8_t>(1) == 0);
+  REQUIRE(rest.read_back<uint16_t>(std::endian::big) == 0xBEEF);
+
+  REQUIRE(wlib::blob::io::read(fd, rest) == 0);
+  ::close(fd);
+  REQUIRE_THROWS(wlib::blob::io::write(fd, header));
+  std::filesystem::remove(path);
+}
+
+TEST_CASE("vectored pipe transfer with partial reads and writes")
+{
+  int pipe_fds[2];
+  REQUIRE(::pipe(pipe_fds) == 0);
+
+  std::vector<std::byte> first(100'000);
+  std::vector<std::byte> second(150'000);
+  for (std::size_t i = 0; i < first.size(); i++)
+    first[i] = static_cast<std::byte>(i % 251);
+  for (std::size_t i = 0; i < second.size(); i++)
+    second[i] = static_cast<std::byte>(i % 241);
+
+  bool        written = false;
+  std::thread writer([&] {
+    written = wlib::blob::io::try_write(pipe_fds[1], first, second);
+    ::close(pipe_fds[1]);
+  });
+
+  std::vector<std::byte> a_raw(120'000);
+  std::vector<std::byte> b_raw(200'000);
+  wlib::blob::MemoryBlob a(a_raw.data(), a_raw.size());
+  wlib::blob::MemoryBlob b(b_raw.data(), b_raw.size());
+  std::size_t const      number_of_bytes = wlib::blob::io::read(pipe_fds[0], a, b);
+  writer.join();
+  ::close(pipe_fds[0]);
+
+  REQUIRE(written);
+  REQUIRE(number_of_bytes == 250'000);
+  REQUIRE(a.get_number_of_free_bytes() == 0);
+  REQUIRE(b.get_number_of_used_bytes() == 130'000);
+  REQUIRE(a.read<uint8_t>(99'999) == 99'999 % 251);
+  REQUIRE(a.read<uint8_t>(100'000) == 0);
+  REQUIRE(b.read<uint8_t>(0) == 20'000 % 241);
+  REQUIRE(b.read_back<uint8_t>() == 149'999 % 241);
+}
+
+TEST_CASE("vectored transfer on a non-blocking pipe")
+{
+  int pipe_fds[2];
+  REQUIRE(::pipe(pipe_fds) == 0);
+  REQUIRE(::fcntl(pipe_fds[0], F_SETFL, O_NONBLOCK) == 0);
+  REQUIRE(::fcntl(pipe_fds[1], F_SETFL, O_NONBLOCK) == 0);
+
+  // Data received before EAGAIN ends up in the blobs.
+  std::vector<std::byte> small(100, std::byte(0x5A));
+  REQUIRE(wlib::blob::io::try_write(pipe_fds[1], small));
+  wlib::blob::StaticBlob<64>  a;
+  wlib::blob::StaticBlob<512> b;
+  std::size_t                 number_of_bytes = 0;
+  REQUIRE(wlib::blob::io::try_read(pipe_fds[0], number_of_bytes, a, b));
+  REQUIRE(number_of_bytes == 100);
+  REQUIRE(a.get_number_of_free_bytes() == 0);
+  REQUIRE(b.get_number_of_used_bytes() == 36);
+  REQUIRE(b.read_back<uint8_t>() == 0x5A);
+
+  REQUIRE_FALSE(wlib::blob::io::try_read(pipe_fds[0], number_of_bytes, b));
+  REQUIRE(errno == EAGAIN);
+  REQUIRE(number_of_bytes == 0);
+  REQUIRE(b.get_number_of_used_bytes() == 36);
+
+  // A write stopped by a full pipe reports how much went out.
+  std::vector<std::byte> const     large(4 * 1024 * 1024);
+  std::span<std::byte const> const buffers[]{ large };
+  REQUIRE_FALSE(wlib::blob::io::try_writev(pipe_fds[1], buffers, number_of_bytes));
+  REQUIRE(errno == EAGAIN);
+  REQUIRE(number_of_bytes != 0);
+  REQUIRE(number_of_bytes < large.size());
+
+  std::vector<std::byte> drain_raw(large.size());
+  wlib::blob::MemoryBlob drain(drain_raw.data(), drain_raw.size());
+  std::size_t            received = 0;
+  REQUIRE(wlib::blob::io::try_read(pipe_fds[0], received, drain));
+  REQUIRE(received == number_of_bytes);
+  REQUIRE(drain.get_number_of_used_bytes() == number_of_bytes);
+
+  ::close(pipe_fds[0]);
+  ::close(pipe_fds[1]);
+}
+#endif
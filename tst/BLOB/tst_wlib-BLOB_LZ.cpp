@@ -0,0 +1,148 @@
+#include <ut_catch.hpp>
+#include <wlib-BLOB_LZ.hpp>
+
+#include <chrono>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+  // Telemetry-like records: slowly changing counters with a fixed header.
+  std::vector<std::byte> make_telemetry(std::size_t const& number_of_bytes, uint32_t seed)
+  {
+    std::mt19937           rng(seed);
+    std::vector<std::byte> data;
+    data.reserve(number_of_bytes + 32);
+    wlib::blob::StaticBlob<32> record;
+    for (uint32_t i = 0; data.size() < number_of_bytes; i++)
+    {
+      record.clear();
+      record.insert_back(std::endian::big, static_cast<uint16_t>(0xAA55), static_cast<uint32_t>(i), static_cast<uint16_t>(rng() % 4), 3.25f, static_cast<uint64_t>(i / 16));
+      data.insert(data.end(), record.get_blob().begin(), record.get_blob().end());
+    }
+    data.resize(number_of_bytes);
+    return data;
+  }
+}    // namespace
+
+TEST_CASE("lz block round trip")
+{
+  std::mt19937 rng(3);
+  for (std::size_t size : { 0, 1, 12, 13, 100, 4096, 100'000 })
+  {
+    for (bool random : { false, true })
+    {
+      std::vector<std::byte> input = make_telemetry(size, 1);
+      if (random)
+      {
+        for (std::byte& value : input)
+          value = static_cast<std::byte>(rng());
+      }
+
+      std::vector<std::byte> compressed_raw(wlib::blob::lz::max_compressed_size(size));
+      wlib::blob::MemoryBlob compressed(compressed_raw.data(), compressed_raw.size());
+      wlib::blob::lz::compress_back(compressed, input);
+      if (!random && size >= 4096)
+        REQUIRE(compressed.get_number_of_used_bytes() < size / 2);
+
+      std::vector<std::byte> output_raw(size);
+      wlib::blob::MemoryBlob output(output_raw.data(), output_raw.size());
+      wlib::blob::lz::decompress_back(output, compressed.get_blob());
+      REQUIRE(output_raw == input);
+      REQUIRE(output.get_number_of_free_bytes() == 0);
+    }
+  }
+}
+
+TEST_CASE("lz bounded output")
+{
+  std::vector<std::byte> const input = make_telemetry(10'000, 2);
+
+  wlib::blob::StaticBlob<64> small;
+  REQUIRE_FALSE(wlib::blob::lz::try_compress_back(small, input));
+  REQUIRE(small.get_number_of_used_bytes() == 0);
+  REQUIRE_THROWS(wlib::blob::lz::compress_back(small, input));
+
+  std::vector<std::byte> compressed_raw(wlib::blob::lz::max_compressed_size(input.size()));
+  wlib::blob::MemoryBlob compressed(compressed_raw.data(), compressed_raw.size());
+  wlib::blob::lz::compress_back(compressed, input);
+
+  std::vector<std::byte> output_raw(input.size() - 1);
+  wlib::blob::MemoryBlob output(output_raw.data(), output_raw.size());
+  REQUIRE_FALSE(wlib::blob::lz::try_decompress_back(output, compressed.get_blob()));
+  REQUIRE_FALSE(wlib::blob::lz::try_decompress_back(output, compressed.get_blob().first(compressed.get_number_of_used_bytes() / 2)));
+  REQUIRE_THROWS(wlib::blob::lz::decompress_back(output, std::array<std::byte, 3>{ std::byte(0x00), std::byte(0x01), std::byte(0x00) }));
+  REQUIRE(output.get_number_of_used_bytes() == 0);
+}
+
+TEST_CASE("lz streaming with sliding window")
+{
+  // A random pattern repeated with a period larger than most chunks, only the window can find it.
+  std::mt19937           rng(5);
+  std::vector<std::byte> pattern(7000);
+  for (std::byte& value : pattern)
+    value = static_cast<std::byte>(rng());
+  std::vector<std::byte> input;
+  while (input.size() < 600'000)
+  {
+    input.insert(input.end(), pattern.begin(), pattern.end());
+    pattern[rng() % pattern.size()] = static_cast<std::byte>(rng());
+  }
+
+  wlib::blob::lz::StreamEncoder              encoder;
+  wlib::blob::lz::StreamDecoder              decoder;
+  std::vector<std::byte>                     block_raw(wlib::blob::lz::max_compressed_size(wlib::blob::lz::max_block_size));
+  std::vector<std::byte>                     output_raw(input.size());
+  wlib::blob::MemoryBlob                     output(output_raw.data(), output_raw.size());
+  std::size_t                                compressed_total = 0;
+  std::size_t                                oneshot_total    = 0;
+  std::uniform_int_distribution<std::size_t> chunk(1, 5000);
+
+  for (std::size_t offset = 0; offset < input.size();)
+  {
+    std::span<std::byte const> const part(input.data() + offset, std::min(chunk(rng), input.size() - offset));
+    wlib::blob::MemoryBlob           block(block_raw.data(), block_raw.size());
+    encoder.compress_back(block, part);
+    compressed_total += block.get_number_of_used_bytes();
+    decoder.decompress_back(output, block.get_blob());
+
+    block.clear();
+    wlib::blob::lz::compress_back(block, part);
+    oneshot_total += block.get_number_of_used_bytes();
+    offset += part.size();
+  }
+  REQUIRE(output_raw == input);
+  REQUIRE(compressed_total < input.size() / 20);
+  REQUIRE(oneshot_total > input.size() / 2);
+
+  std::vector<std::byte> too_large(wlib::blob::lz::max_block_size + 1);
+  wlib::blob::MemoryBlob block(block_raw.data(), block_raw.size());
+  REQUIRE_FALSE(encoder.try_compress_back(block, too_large));
+}
+
+TEST_CASE("lz throughput", "[.benchmark]")
+{
+  std::vector<std::byte> const input = make_telemetry(64 << 20, 6);
+  std::vector<std::byte>       compressed(wlib::blob::lz::max_compressed_size(input.size()));
+  std::vector<std::byte>       output(input.size());
+
+  auto const measure = [&input](auto&& function) {
+    auto const start = std::chrono::steady_clock::now();
+    function();
+    std::chrono::duration<double> const seconds = std::chrono::steady_clock::now() - start;
+    return static_cast<double>(input.size()) / seconds.count() / (1 << 20);
+  };
+
+  std::size_t  compressed_size   = 0;
+  std::size_t  decompressed_size = 0;
+  double const copy_rate         = measure([&] { std::memcpy(output.data(), input.data(), input.size()); });
+  double const compress_rate     = measure([&] { compressed_size = wlib::blob::lz::compress(compressed.data(), compressed.size(), input.data(), input.size()); });
+  double const decompress_rate   = measure([&] {
+    REQUIRE(wlib::blob::lz::decompress(output.data(), output.size(), compressed.data(), compressed_size, decompressed_size));
+  });
+  REQUIRE(output == input);
+
+  WARN("memcpy " << copy_rate << " MiB/s, compress " << compress_rate << " MiB/s (ratio " << static_cast<double>(input.size()) / compressed_size
+                 << "), decompress " << decompress_rate << " MiB/s");
+}
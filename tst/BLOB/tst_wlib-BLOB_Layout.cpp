@@ -0,0 +1,116 @@
+#include <ut_catch.hpp>
+#include <wlib-BLOB_Layout.hpp>
+
+namespace
+{
+  using header_t = wlib::blob::MessageLayout<wlib::blob::Field<"type", uint8_t>,
+                                             wlib::blob::Field<"id", uint16_t, std::endian::big>,
+                                             wlib::blob::BytesField<"mac", 6>,
+                                             wlib::blob::Field<"temperature", float, std::endian::little>>;
+
+  using packet_t = wlib::blob::MessageLayout<wlib::blob::Field<"id", uint32_t, std::endian::big>,
+                                             wlib::blob::PrefixedField<"name", uint8_t>,
+                                             wlib::blob::PrefixedField<"payload", uint16_t, std::endian::big>,
+                                             wlib::blob::Field<"crc", uint16_t, std::endian::little>>;
+
+  static_assert(header_t::is_fixed);
+  static_assert(header_t::min_size == 13);
+  static_assert(header_t::static_offsets[3] == 9);
+  static_assert(header_t::index_of<"mac"> == 2);
+  static_assert(header_t::index_of<"unknown"> == header_t::number_of_fields);
+
+  static_assert(!packet_t::is_fixed);
+  static_assert(packet_t::min_size == 9);
+  static_assert(packet_t::static_offsets[1] == 4);
+  static_assert(packet_t::static_offsets[2] == packet_t::no_offset);
+
+  constexpr uint16_t compile_time_id()
+  {
+    std::byte raw[header_t::min_size]{};
+
+    wlib::blob::MessageView<header_t, std::byte> view;
+    view.attach(raw);
+    view.set<"id">(0x1234);
+    return view.get<"id">();
+  }
+  static_assert(compile_time_id() == 0x1234);
+}    // namespace
+
+TEST_CASE("message layout with fixed fields")
+{
+  std::byte              buffer[16]{};
+  wlib::blob::MemoryBlob blob(buffer);
+  blob.insert_back(std::endian::big, static_cast<uint8_t>(7), static_cast<uint16_t>(0xBEEF));
+  blob.insert_back(std::span<uint8_t const>(std::array<uint8_t, 6>{ 1, 2, 3, 4, 5, 6 }));
+  blob.insert_back(21.5f, std::endian::little);
+
+  wlib::blob::MessageView<header_t> view;
+  REQUIRE(view.try_attach(blob.get_blob()));
+  REQUIRE(view.get_number_of_bytes() == 13);
+  REQUIRE(view.get<"type">() == 7);
+  REQUIRE(view.get<"id">() == 0xBEEF);
+  REQUIRE(view.get<"mac">().size() == 6);
+  REQUIRE(view.get<"mac">()[5] == std::byte(6));
+  REQUIRE(view.get<"temperature">() == 21.5f);
+
+  wlib::blob::MessageView<header_t, std::byte> writer;
+  writer.attach(blob.get_blob());
+  writer.set<"id">(0x0102);
+  writer.set<"temperature">(-1.0);
+  REQUIRE(blob.read<uint16_t>(1, std::endian::big) == 0x0102);
+  REQUIRE(blob.read_back<float>(std::endian::little) == -1.0f);
+
+  blob.remove_back();
+  REQUIRE_FALSE(view.try_attach(blob.get_blob()));
+  REQUIRE_FALSE(view.is_attached());
+}
+
+TEST_CASE("message layout with length prefixed fields")
+{
+  std::byte              buffer[32]{};
+  wlib::blob::MemoryBlob blob(buffer);
+  blob.insert_back(static_cast<uint32_t>(0xCAFE'0001), std::endian::big);
+  blob.insert_back(static_cast<uint8_t>(3));
+  blob.insert_back(std::endian::big, std::byte('a'), std::byte('b'), std::byte('c'));
+  blob.insert_back(static_cast<uint16_t>(2), std::endian::big);
+  blob.insert_back(std::endian::big, std::byte(0xF0), std::byte(0x0F));
+  blob.insert_back(static_cast<uint16_t>(0x1234), std::endian::little);
+  blob.insert_back(std::byte(0xFF));
+
+  wlib::blob::MessageView<packet_t> view;
+  REQUIRE(view.try_attach(blob.get_blob()));
+  REQUIRE(view.get_number_of_bytes() == 14);
+  REQUIRE(view.get<"id">() == 0xCAFE'0001);
+  REQUIRE(view.get<"name">().size() == 3);
+  REQUIRE(view.get<"name">()[2] == std::byte('c'));
+  REQUIRE(view.get<"payload">().size() == 2);
+  REQUIRE(view.get<"payload">()[0] == std::byte(0xF0));
+  REQUIRE(view.get<"crc">() == 0x1234);
+
+  blob.overwrite(4, std::byte(20));
+  REQUIRE_FALSE(view.try_attach(blob.get_blob()));
+  blob.overwrite(4, std::byte(3));
+  blob.remove_back(2);
+  REQUIRE_FALSE(view.try_attach(blob.get_blob()));
+  REQUIRE_THROWS(view.attach(blob.get_blob()));
+}
+
+TEST_CASE("message layout rejects oversized length prefix")
+{
+  using wide_t = wlib::blob::MessageLayout<wlib::blob::PrefixedField<"p", uint64_t, std::endian::big>>;
+
+  std::byte              buffer[16]{};
+  wlib::blob::MemoryBlob blob(buffer);
+  blob.insert_back(static_cast<uint64_t>(0xFFFF'FFFF'FFFF'FFFF), std::endian::big);
+  blob.insert_back(static_cast<uint64_t>(0));
+
+  wlib::blob::MessageView<wide_t> view;
+  REQUIRE_FALSE(view.try_attach(blob.get_blob()));
+  blob.overwrite(0, static_cast<uint64_t>(0xFFFF'FFFF'FFFF'FFF8), std::endian::big);
+  REQUIRE_FALSE(view.try_attach(blob.get_blob()));
+  blob.overwrite(0, static_cast<uint64_t>(9), std::endian::big);
+  REQUIRE_FALSE(view.try_attach(blob.get_blob()));
+  blob.overwrite(0, static_cast<uint64_t>(8), std::endian::big);
+  REQUIRE(view.try_attach(blob.get_blob()));
+  REQUIRE(view.get<"p">().size() == 8);
+}
@@ -0,0 +1,107 @@
+#include <ut_catch.hpp>
+#include <wlib-BLOB_Pool.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+TEST_CASE("blob pool acquire and release")
+{
+  wlib::blob::BlobPool pool(100, 2);
+  REQUIRE(pool.get_buffer_size() == 100);
+  REQUIRE(pool.get_statistics().capacity == 2);
+
+  wlib::blob::PooledBlob first = pool.acquire();
+  REQUIRE(first.is_pooled());
+  REQUIRE(reinterpret_cast<std::uintptr_t>(first.get_blob().data()) % wlib::blob::BlobPool::alignment == 0);
+  REQUIRE(first.get_number_of_free_bytes() == 100);
+  first.insert_back<uint32_t, std::endian::big>(0x0102'0304);
+  REQUIRE(first.read_front<uint16_t>(std::endian::big) == 0x0102);
+
+  wlib::blob::PooledBlob second;
+  REQUIRE_FALSE(second.is_valid());
+  REQUIRE(pool.try_acquire(second));
+  REQUIRE(second.get_blob().data() != first.get_blob().data());
+
+  wlib::blob::PooledBlob third;
+  REQUIRE_FALSE(pool.try_acquire(third));
+  third = pool.acquire();
+  REQUIRE(third.is_valid());
+  REQUIRE_FALSE(third.is_pooled());
+  REQUIRE(third.get_total_number_of_bytes() == 100);
+
+  wlib::blob::PooledBlob moved(std::move(first));
+  REQUIRE_FALSE(first.is_valid());
+  REQUIRE(moved.get_number_of_used_bytes() == 4);
+  moved.release();
+  third.release();
+
+  wlib::blob::pool_statistics const statistics = pool.get_statistics();
+  REQUIRE(statistics.in_use == 1);
+  REQUIRE(statistics.high_water_mark == 3);
+  REQUIRE(statistics.acquisitions == 3);
+  REQUIRE(statistics.misses == 1);
+  REQUIRE(statistics.cross_thread_releases == 0);
+
+  REQUIRE(pool.try_acquire(first));
+  REQUIRE(first.get_number_of_used_bytes() == 0);
+
+  REQUIRE_THROWS_AS(wlib::blob::BlobPool(16, UINT32_MAX), std::out_of_range);
+}
+
+TEST_CASE("blob pool high water mark")
+{
+  wlib::blob::BlobPool pool(16, 2);
+  for (int i = 0; i < 3; i++)
+    wlib::blob::PooledBlob blob = pool.acquire();
+  REQUIRE(pool.get_statistics().high_water_mark == 1);
+
+  wlib::blob::PooledBlob first  = pool.acquire();
+  wlib::blob::PooledBlob second = pool.acquire();
+  wlib::blob::PooledBlob heap   = pool.acquire();
+  heap.release();
+  heap = pool.acquire();
+  second.release();
+
+  wlib::blob::pool_statistics const statistics = pool.get_statistics();
+  REQUIRE(statistics.in_use == 2);
+  REQUIRE(statistics.high_water_mark == 3);
+  REQUIRE(statistics.acquisitions == 7);
+  REQUIRE(statistics.misses == 2);
+}
+
+TEST_CASE("blob pool across threads")
+{
+  wlib::blob::BlobPool pool(64, 16);
+  std::atomic<int>     corrupted{ 0 };
+
+  std::vector<std::thread> workers;
+  for (int t = 0; t < 4; t++)
+  {
+    workers.emplace_back([&pool, &corrupted, t] {
+      for (int i = 0; i < 10'000; i++)
+      {
+        wlib::blob::PooledBlob blob = pool.acquire();
+        blob.insert_back(static_cast<uint32_t>(t));
+        blob.insert_back(static_cast<uint32_t>(i));
+        if (blob.read_front<uint32_t>() != static_cast<uint32_t>(t))
+          corrupted++;
+      }
+    });
+  }
+  for (std::thread& worker : workers)
+    worker.join();
+
+  REQUIRE(corrupted == 0);
+
+  wlib::blob::PooledBlob handed_over = pool.acquire();
+  std::thread([blob = std::move(handed_over)]() mutable { blob.release(); }).join();
+
+  wlib::blob::pool_statistics const statistics = pool.get_statistics();
+  REQUIRE(statistics.in_use == 0);
+  REQUIRE(statistics.acquisitions == 40'001);
+  REQUIRE(statistics.misses == 0);
+  REQUIRE(statistics.high_water_mark <= 4);
+  REQUIRE(statistics.cross_thread_releases == 1);
+}
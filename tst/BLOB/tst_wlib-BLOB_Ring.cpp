@@ -0,0 +1,78 @@
+#include <ut_catch.hpp>
+#include <wlib-BLOB_Ring.hpp>
+
+#include <thread>
+#include <vector>
+
+TEST_CASE("byte ring wrap around")
+{
+  wlib::blob::ByteRing ring(12);
+  REQUIRE(ring.get_total_number_of_bytes() == 16);
+  REQUIRE(ring.get_readable_region().empty());
+
+  REQUIRE(ring.try_insert_back<uint64_t, std::endian::big>(0x0102'0304'0506'0708));
+  REQUIRE(ring.try_insert_back(static_cast<uint32_t>(0xAABB'CCDD), std::endian::little));
+  REQUIRE(ring.get_number_of_free_bytes() == 4);
+  REQUIRE_FALSE(ring.try_insert_back(static_cast<uint64_t>(0)));
+  REQUIRE_THROWS(ring.insert_back(static_cast<uint64_t>(0)));
+
+  REQUIRE(ring.extract_front<uint32_t>(std::endian::big) == 0x0102'0304);
+  std::span<std::byte const> region = ring.get_readable_region();
+  REQUIRE(region.size() == 8);
+  REQUIRE(region[0] == std::byte(0x05));
+  ring.commit_read(4);
+
+  ring.insert_back(static_cast<uint64_t>(0x1122'3344'5566'7788), std::endian::big);
+  REQUIRE(ring.get_number_of_used_bytes() == 12);
+  REQUIRE(ring.extract_front<uint32_t>(std::endian::little) == 0xAABB'CCDD);
+  REQUIRE(ring.get_readable_region().size() == 4);
+  REQUIRE(ring.extract_front<uint64_t>(std::endian::big) == 0x1122'3344'5566'7788);
+  REQUIRE_THROWS(ring.extract_front<uint8_t>());
+
+  std::span<std::byte> window = ring.get_writable_region();
+  REQUIRE(window.size() == 12);
+  window[0] = std::byte(0x42);
+  ring.commit_write(1);
+  REQUIRE(ring.extract_front<uint8_t>() == 0x42);
+}
+
+TEST_CASE("byte ring producer and consumer threads")
+{
+  constexpr std::size_t number_of_bytes = 4 << 20;
+  wlib::blob::ByteRing  ring(4096);
+
+  std::thread producer([&ring] {
+    std::byte   chunk[777];
+    std::size_t sent = 0;
+    while (sent < number_of_bytes)
+    {
+      std::size_t const size = (number_of_bytes - sent < sizeof(chunk)) ? number_of_bytes - sent : sizeof(chunk);
+      for (std::size_t i = 0; i < size; i++)
+        chunk[i] = static_cast<std::byte>((sent + i) % 253);
+      while (!ring.try_insert_back(chunk, size))
+        std::this_thread::yield();
+      sent += size;
+    }
+  });
+
+  std::size_t received   = 0;
+  std::size_t mismatches = 0;
+  while (received < number_of_bytes)
+  {
+    std::span<std::byte const> const region = ring.get_readable_region();
+    if (region.empty())
+    {
+      std::this_thread::yield();
+      continue;
+    }
+    for (std::size_t i = 0; i < region.size(); i++)
+      mismatches += (region[i] != static_cast<std::byte>((received + i) % 253));
+    received += region.size();
+    ring.commit_read(region.size());
+  }
+  producer.join();
+
+  REQUIRE(received == number_of_bytes);
+  REQUIRE(mismatches == 0);
+  REQUIRE(ring.get_number_of_used_bytes() == 0);
+}
@@ -0,0 +1,72 @@
+#include <ut_catch.hpp>
+#include <wlib-BLOB_Search.hpp>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+TEST_CASE("span search against reference")
+{
+  std::mt19937           rng(42);
+  std::vector<std::byte> data(1000);
+  for (std::byte& value : data)
+    value = static_cast<std::byte>(rng() % 16);
+
+  std::array<std::byte, 3> const  small_set{ std::byte(7), std::byte(3), std::byte(11) };
+  std::array<std::byte, 12> const large_set{ std::byte(1), std::byte(2), std::byte(4), std::byte(5), std::byte(6), std::byte(8),
+                                             std::byte(9), std::byte(10), std::byte(12), std::byte(13), std::byte(14), std::byte(15) };
+  for (std::size_t size : { 0, 1, 15, 16, 17, 31, 32, 33, 100, 1000 })
+  {
+    std::span<std::byte const> const span(data.data(), size);
+    auto const                       index = [&span](auto it) { return (it == span.end()) ? wlib::blob::npos : static_cast<std::size_t>(it - span.begin()); };
+    for (std::byte value : { std::byte(0), std::byte(5), std::byte(0xFF) })
+    {
+      REQUIRE(wlib::blob::find(span, value) == index(std::find(span.begin(), span.end(), value)));
+      REQUIRE(wlib::blob::count(span, value) == static_cast<std::size_t>(std::count(span.begin(), span.end(), value)));
+    }
+    REQUIRE(wlib::blob::find_any_of(span, small_set) == index(std::find_first_of(span.begin(), span.end(), small_set.begin(), small_set.end())));
+    REQUIRE(wlib::blob::find_any_of(span, large_set) == index(std::find_first_of(span.begin(), span.end(), large_set.begin(), large_set.end())));
+    for (std::size_t length : { 1, 2, 3, 5 })
+    {
+      std::span<std::byte const> const pattern(data.data() + 900, length);
+      REQUIRE(wlib::blob::find(span, pattern) == index(std::search(span.begin(), span.end(), pattern.begin(), pattern.end())));
+    }
+  }
+  REQUIRE(wlib::blob::find_any_of(data, std::span<std::byte const>()) == wlib::blob::npos);
+  REQUIRE(wlib::blob::find(data, std::span<std::byte const>()) == 0);
+}
+
+TEST_CASE("span search for a single marker at every position")
+{
+  std::array<std::byte, 3> const pattern{ std::byte(0x7E), std::byte(0x01), std::byte(0x7F) };
+  std::array<std::byte, 2> const set{ std::byte(0x7F), std::byte(0x80) };
+  for (std::size_t position = 0; position < 100; position++)
+  {
+    std::vector<std::byte> data(100 + pattern.size());
+    std::copy(pattern.begin(), pattern.end(), data.begin() + static_cast<std::ptrdiff_t>(position));
+    REQUIRE(wlib::blob::find(data, std::byte(0x7E)) == position);
+    REQUIRE(wlib::blob::find_any_of(data, set) == position + 2);
+    REQUIRE(wlib::blob::find(data, pattern) == position);
+    REQUIRE(wlib::blob::count(data, std::byte(0x01)) == 1);
+  }
+}
+
+TEST_CASE("blob search from offset")
+{
+  wlib::blob::StaticBlob<128> blob;
+  for (int i = 0; i < 3; i++)
+  {
+    blob.insert_back<uint16_t, std::endian::big>(0xAA55);
+    blob.insert_back(std::endian::big, static_cast<uint8_t>(i), static_cast<uint32_t>(0x7E7E'7E7E));
+  }
+  std::array<std::byte, 2> const sync{ std::byte(0xAA), std::byte(0x55) };
+
+  REQUIRE(wlib::blob::find(blob, sync) == 0);
+  REQUIRE(wlib::blob::find(blob, sync, 1) == 7);
+  REQUIRE(wlib::blob::find(blob, sync, 15) == wlib::blob::npos);
+  REQUIRE(wlib::blob::find(blob, std::byte(0x02)) == 16);
+  REQUIRE(wlib::blob::find_any_of(blob, std::array<std::byte, 2>{ std::byte(0x01), std::byte(0x02) }, 3) == 9);
+  REQUIRE(wlib::blob::count(blob, std::byte(0x7E)) == 12);
+  REQUIRE(wlib::blob::count(blob, std::byte(0x7E), 10) == 8);
+  REQUIRE(wlib::blob::find(blob, std::byte(0x7E), 22) == wlib::blob::npos);
+}
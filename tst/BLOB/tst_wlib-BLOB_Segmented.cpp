@@ -0,0 +1,178 @@
+#include <ut_catch.hpp>
+#include <wlib-BLOB_Segmented.hpp>
+#include <wlib-CRC_32.hpp>
+
+namespace
+{
+  template <typename T> std::size_t flatten(T const& blob, std::byte* dst)
+  {
+    std::size_t idx = 0;
+    for (auto const& seg : blob.get_segments())
+    {
+      for (std::byte entry : seg)
+        dst[idx++] = entry;
+    }
+    return idx;
+  }
+}    // namespace
+
+TEST_CASE("segmented blob reference external payload")
+{
+  std::byte payload[1024]{};
+  for (std::size_t i = 0; i < sizeof(payload); i++)
+    payload[i] = static_cast<std::byte>(i);
+
+  wlib::blob::SegmentedBlob<8, 16, 16> blob;
+  REQUIRE(blob.get_number_of_used_bytes() == 0);
+  REQUIRE(blob.get_number_of_segments() == 0);
+
+  blob.insert_back(static_cast<uint32_t>(0xDEAD'BEEF), std::endian::big);
+  blob.insert_back(static_cast<uint16_t>(0xCAFE), std::endian::big);
+  REQUIRE(blob.get_number_of_segments() == 1);
+
+  blob.reference(4, payload);
+  REQUIRE(blob.get_number_of_segments() == 3);
+  REQUIRE(blob.get_number_of_used_bytes() == 1030);
+  REQUIRE(blob.get_segments()[1].data() == payload);
+
+  blob.insert_front(static_cast<uint16_t>(0x0406), std::endian::big);
+  REQUIRE(blob.get_number_of_segments() == 4);
+  blob.insert_front(static_cast<uint8_t>(0x7E));
+  REQUIRE(blob.get_number_of_segments() == 4);
+  REQUIRE(blob.get_number_of_free_head_bytes() == 13);
+
+  REQUIRE(blob.read_front<uint8_t>() == 0x7E);
+  REQUIRE(blob.read<uint16_t>(1, std::endian::big) == 0x0406);
+  REQUIRE(blob.read<uint32_t>(3, std::endian::big) == 0xDEAD'BEEF);
+  REQUIRE(blob.read<uint32_t>(5, std::endian::big) == 0xBEEF'0001);
+  REQUIRE(blob.read<uint32_t>(5, std::endian::little) == 0x0100'EFBE);
+  REQUIRE(blob.read_back<uint16_t>(std::endian::big) == 0xCAFE);
+  REQUIRE(blob.read<uint32_t>(blob.get_number_of_used_bytes() - 4, std::endian::big) == 0xFEFF'CAFE);
+  REQUIRE_THROWS(blob.read<uint32_t>(blob.get_number_of_used_bytes() - 2));
+}
+
+TEST_CASE("segmented blob segments for scatter gather")
+{
+  std::byte payload[9]{
+    std::byte(0x31), std::byte(0x32), std::byte(0x33), std::byte(0x34), std::byte(0x35), std::byte(0x36), std::byte(0x37), std::byte(0x38), std::byte(0x39),
+  };
+
+  wlib::blob::SegmentedBlob<4> blob;
+  blob.reference_back(std::span(payload).subspan(3));
+  blob.reference_front(std::span(payload).first(3));
+
+  wlib::crc::CRC_32 crc;
+  for (auto const& seg : blob.get_segments())
+    crc(seg);
+
+  REQUIRE(crc.get() == 0xCBF4'3926);
+}
+
+TEST_CASE("segmented blob remove")
+{
+  std::byte payload[8]{
+    std::byte(0x10), std::byte(0x11), std::byte(0x12), std::byte(0x13), std::byte(0x14), std::byte(0x15), std::byte(0x16), std::byte(0x17),
+  };
+
+  wlib::blob::SegmentedBlob<5, 4, 4> blob;
+  blob.insert_back(static_cast<uint16_t>(0x0102), std::endian::big);
+  blob.reference_back(payload);
+  blob.insert_back(static_cast<uint16_t>(0x0304), std::endian::big);
+  REQUIRE(blob.get_number_of_used_bytes() == 12);
+
+  blob.remove(3, 2);
+  REQUIRE(blob.get_number_of_segments() == 4);
+  REQUIRE(blob.get_number_of_used_bytes() == 10);
+
+  std::byte out[16]{};
+  REQUIRE(flatten(blob, out) == 10);
+  REQUIRE(out[2] == std::byte(0x10));
+  REQUIRE(out[3] == std::byte(0x13));
+
+  blob.remove(1, 8);
+  REQUIRE(blob.get_number_of_used_bytes() == 2);
+  REQUIRE(blob.read_front<uint16_t>(std::endian::big) == 0x0104);
+
+  blob.remove_back(2);
+  REQUIRE(blob.get_number_of_used_bytes() == 0);
+  REQUIRE(blob.get_number_of_segments() == 0);
+  REQUIRE(blob.get_number_of_free_tail_bytes() == 4);
+  REQUIRE_THROWS(blob.remove_front(1));
+}
+
+TEST_CASE("segmented blob capacity")
+{
+  std::byte payload[4]{};
+
+  wlib::blob::SegmentedBlob<3, 2, 2> blob;
+  REQUIRE(blob.try_insert_back(static_cast<uint16_t>(0)));
+  REQUIRE(blob.try_insert_front(static_cast<uint16_t>(0)));
+  REQUIRE_FALSE(blob.try_insert_back(static_cast<uint8_t>(0)));
+  REQUIRE_FALSE(blob.try_insert_front(static_cast<uint8_t>(0)));
+  REQUIRE(blob.try_reference(2, payload));
+  REQUIRE_FALSE(blob.try_reference(1, payload));
+  REQUIRE_FALSE(blob.try_reference(9, payload));
+  REQUIRE_THROWS(blob.reference_back(payload));
+  REQUIRE(blob.get_number_of_used_bytes() == 8);
+}
+
+TEST_CASE("segmented blob reuses removed head and tail bytes")
+{
+  std::byte payload[16]{};
+
+  wlib::blob::SegmentedBlob<4, 4, 4> blob;
+  blob.insert_back(static_cast<uint32_t>(0x0102'0304), std::endian::big);
+  REQUIRE(blob.get_number_of_free_tail_bytes() == 0);
+  blob.remove_back(3);
+  REQUIRE(blob.get_number_of_free_tail_bytes() == 3);
+  blob.insert_back(static_cast<uint16_t>(0x0506), std::endian::big);
+  REQUIRE(blob.get_number_of_segments() == 1);
+  REQUIRE(blob.read_front<uint16_t>(std::endian::big) == 0x0105);
+
+  blob.reference_back(payload);
+  blob.insert_front(static_cast<uint16_t>(0xA0A1), std::endian::big);
+  REQUIRE(blob.get_number_of_free_head_bytes() == 2);
+  blob.remove_front(1);
+  REQUIRE(blob.get_number_of_free_head_bytes() == 3);
+  blob.remove_front(1);
+  REQUIRE(blob.get_number_of_free_head_bytes() == 4);
+  REQUIRE(blob.read_front<uint8_t>() == 0x01);
+
+  // The tail bytes before the referenced payload stay in use.
+  blob.remove_back(16);
+  REQUIRE(blob.get_number_of_free_tail_bytes() == 1);
+  REQUIRE(blob.get_number_of_used_bytes() == 3);
+}
+
+TEST_CASE("segmented blob remove inside a segment with a full segment table")
+{
+  std::byte first[8]{};
+  std::byte second[8]{};
+  for (std::size_t i = 0; i < 8; i++)
+  {
+    first[i]  = std::byte(i);
+    second[i] = std::byte(0x10 + i);
+  }
+
+  wlib::blob::SegmentedBlob<2> blob;
+  blob.reference_back(first);
+  blob.reference_back(second);
+  REQUIRE(blob.get_number_of_free_segments() == 0);
+  REQUIRE(blob.try_remove(2, 1));
+  REQUIRE(blob.get_number_of_segments() == 2);
+  REQUIRE(blob.get_number_of_used_bytes() == 15);
+  REQUIRE(blob.get_number_of_free_tail_bytes() == 32 - 7);
+  REQUIRE(blob.read<uint8_t>(1) == 0x01);
+  REQUIRE(blob.read<uint8_t>(2) == 0x03);
+  REQUIRE(blob.read<uint8_t>(7) == 0x10);
+  REQUIRE(first[2] == std::byte(2));
+
+  // Neither owned buffer takes the remaining 7 bytes.
+  wlib::blob::SegmentedBlob<2, 4, 4> small;
+  small.reference_back(first);
+  small.reference_back(second);
+  REQUIRE_FALSE(small.try_remove(9, 1));
+  REQUIRE_THROWS(small.remove(9, 1));
+  REQUIRE(small.get_number_of_used_bytes() == 16);
+  REQUIRE(small.try_remove(8, 1));
+}
@@ -0,0 +1,111 @@
+#include <ut_catch.hpp>
+#include <wlib-BLOB_Serialize.hpp>
+
+#include <vector>
+
+namespace
+{
+  constexpr auto write_header = [](auto& sink) {
+    sink.insert_back(std::endian::big, static_cast<uint8_t>(0x7E), static_cast<uint16_t>(0x0102));
+    sink.template insert_back<uint32_t, std::endian::little>(0x0A0B'0C0D);
+    sink.insert_back(std::byte(0xFF));
+    sink.insert_back(std::span<uint16_t const>(std::array<uint16_t, 3>{ 1, 2, 3 }), std::endian::big);
+  };
+
+  constexpr std::size_t header_size = wlib::blob::measure(write_header);
+  static_assert(header_size == 14);
+
+  constexpr std::array<std::byte, header_size> make_header()
+  {
+    std::array<std::byte, header_size> raw{};
+    wlib::blob::UncheckedWriter        writer(raw.data(), raw.size());
+    write_header(writer);
+    return raw;
+  }
+  static_assert(make_header()[2] == std::byte(0x02));
+  static_assert(make_header()[3] == std::byte(0x0D));
+  static_assert(make_header()[13] == std::byte(0x03));
+}    // namespace
+
+TEST_CASE("sizing blob")
+{
+  wlib::blob::SizingBlob sizer;
+  REQUIRE(sizer.try_insert_back(static_cast<uint64_t>(0)));
+  REQUIRE(sizer.try_insert_back_reverse(std::span<std::byte const>(std::array<std::byte, 3>{})));
+  sizer.insert_back(std::span<double const>(std::array<double, 4>{}));
+  REQUIRE(sizer.get_number_of_used_bytes() == 43);
+  sizer.clear();
+  REQUIRE(sizer.get_number_of_used_bytes() == 0);
+}
+
+TEST_CASE("two pass serialization")
+{
+  std::vector<uint32_t> payload{ 0x0102'0304, 0x0506'0708, 0x090A'0B0C };
+  auto const            write_message = [&payload](auto& sink) {
+    write_header(sink);
+    sink.insert_back(static_cast<uint8_t>(payload.size()));
+    sink.insert_back(std::span<uint32_t const>(payload), std::endian::big);
+  };
+
+  std::size_t const number_of_bytes = wlib::blob::measure(write_message);
+  REQUIRE(number_of_bytes == header_size + 13);
+
+  std::vector<std::byte> buffer(number_of_bytes);
+  wlib::blob::MemoryBlob blob(buffer.data(), buffer.size());
+  blob.insert_back(std::byte(0xAA));
+  REQUIRE_FALSE(wlib::blob::try_serialize_back(blob, write_message));
+  REQUIRE(blob.get_number_of_used_bytes() == 1);
+
+  blob.clear();
+  wlib::blob::serialize_back(blob, write_message);
+  REQUIRE(blob.get_number_of_used_bytes() == number_of_bytes);
+
+  constexpr std::array<std::byte, header_size> header = make_header();
+  for (std::size_t i = 0; i < header_size; i++)
+    REQUIRE(buffer[i] == header[i]);
+  REQUIRE(blob.read<uint8_t>(header_size) == 3);
+  REQUIRE(blob.read<uint32_t>(header_size + 1, std::endian::big) == 0x0102'0304);
+  REQUIRE(blob.read_back<uint32_t>(std::endian::big) == 0x090A'0B0C);
+  REQUIRE_THROWS(wlib::blob::serialize_back(blob, write_message));
+
+  wlib::blob::StaticBlob<header_size> fixed;
+  REQUIRE(wlib::blob::try_serialize_back(fixed, write_header));
+  REQUIRE(fixed.get_number_of_free_bytes() == 0);
+}
+
+TEST_CASE("reserved write window")
+{
+  uint16_t samples[50]{};
+  for (std::size_t i = 0; i < 50; i++)
+    samples[i] = static_cast<uint16_t>(i * 1000);
+
+  wlib::blob::StaticBlob<128> blob;
+  blob.insert_back(std::byte(0x55));
+  REQUIRE(wlib::blob::try_reserve_back(blob, 101, [&samples](wlib::blob::UncheckedWriter& window) {
+    REQUIRE(window.get_number_of_free_bytes() == 101);
+    for (uint16_t sample : samples)
+      window.insert_back<uint16_t, std::endian::big>(sample);
+    REQUIRE(window.get_number_of_free_bytes() == 1);
+  }));
+  REQUIRE(blob.get_number_of_used_bytes() == 101);
+  REQUIRE(blob.read<uint16_t>(1 + 2 * 49, std::endian::big) == 49000);
+
+  REQUIRE_FALSE(wlib::blob::try_reserve_back(blob, 28, [](wlib::blob::UncheckedWriter&) { FAIL(); }));
+  wlib::blob::reserve_back(blob, 27, [](wlib::blob::UncheckedWriter& window) { window.insert_back(std::endian::little, 1.0, 2.0f); });
+  REQUIRE(blob.get_number_of_used_bytes() == 113);
+  REQUIRE(blob.read_back<float>(std::endian::little) == 2.0f);
+  REQUIRE_THROWS(wlib::blob::reserve_back(blob, 16, [](wlib::blob::UncheckedWriter&) {}));
+}
+
+TEST_CASE("throwing writer leaves the blob unchanged")
+{
+  wlib::blob::StaticBlob<32> source;
+  wlib::blob::StaticBlob<32> blob;
+  blob.insert_back(std::byte(0x55));
+  REQUIRE_THROWS(wlib::blob::reserve_back(blob, 16, [&source](wlib::blob::UncheckedWriter& window) {
+    window.insert_back(uint32_t{ 7 });
+    window.insert_back(source.read<uint32_t>(0));
+  }));
+  REQUIRE(blob.get_number_of_used_bytes() == 1);
+  REQUIRE(blob.get_number_of_free_bytes() == 31);
+}
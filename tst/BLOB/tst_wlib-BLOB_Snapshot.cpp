@@ -0,0 +1,97 @@
+#include <ut_catch.hpp>
+#include <wlib-BLOB_Snapshot.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+TEST_CASE("copy-on-write snapshots")
+{
+  wlib::blob::CowBlob blob(1000, 64);
+  for (uint32_t idx = 0; idx < 200; idx++)
+    blob.insert_back(idx, std::endian::big);
+  REQUIRE(blob.get_number_of_used_bytes() == 800);
+  REQUIRE_FALSE(blob.try_insert_back(std::span<std::byte const>(std::vector<std::byte>(201))));
+
+  wlib::blob::BlobSnapshot const first = blob.snapshot();
+  REQUIRE(first.get_number_of_chunks() == 13);
+  REQUIRE(first.get_chunk(12).size() == 32);
+  REQUIRE(first.get_chunk(13).empty());
+
+  // Only the chunks written after the snapshot are copied.
+  blob.overwrite<uint32_t>(4 * 10, 0xDEAD'BEEF);
+  blob.overwrite<uint32_t>(4 * 11, 0xFEED'FACE);
+  REQUIRE(blob.get_number_of_chunk_copies() == 1);
+  blob.overwrite<uint32_t>(62, 0xFFFF'FFFF);    // spans chunk 0 and 1
+  REQUIRE(blob.get_number_of_chunk_copies() == 2);
+  blob.insert_back(static_cast<uint64_t>(0));
+  REQUIRE(blob.get_number_of_chunk_copies() == 3);
+
+  REQUIRE(blob.read<uint32_t>(40) == 0xDEAD'BEEF);
+  REQUIRE(first.read<uint32_t>(40, std::endian::big) == 10);
+  REQUIRE(first.read<uint32_t>(60, std::endian::big) == 15);
+  REQUIRE(first.read<uint32_t>(64, std::endian::big) == 16);
+  REQUIRE(first.get_number_of_used_bytes() == 800);
+  REQUIRE_THROWS(first.read<uint8_t>(800));
+
+  // A later snapshot shares the copies, snapshots outlive each other and the blob.
+  wlib::blob::BlobSnapshot second = blob.snapshot();
+  wlib::blob::BlobSnapshot third  = second;
+  blob.overwrite<uint32_t>(4 * 10, 0);
+  REQUIRE(blob.get_number_of_chunk_copies() == 4);
+  REQUIRE(second.read<uint32_t>(40) == 0xDEAD'BEEF);
+  second.reset();
+  REQUIRE(third.read<uint32_t>(40) == 0xDEAD'BEEF);
+  REQUIRE(third.read<uint32_t>(4 * 100, std::endian::big) == 100);
+
+  // Rewriting from scratch does not copy bytes nobody reads.
+  blob.clear();
+  blob.insert_back(static_cast<uint8_t>(7));
+  REQUIRE(blob.get_number_of_chunk_copies() == 4);
+  REQUIRE(first.read<uint32_t>(0, std::endian::big) == 0);
+  REQUIRE_THROWS(blob.overwrite<uint8_t>(1, 0));
+  REQUIRE_THROWS(blob.remove_back(2));
+  blob.remove_back();
+  REQUIRE(blob.snapshot().get_number_of_chunks() == 0);
+}
+
+TEST_CASE("copy-on-write blob with a zero chunk size")
+{
+  REQUIRE_THROWS_AS(wlib::blob::CowBlob(100, 0), std::out_of_range);
+}
+
+TEST_CASE("snapshots read on other threads")
+{
+  wlib::blob::CowBlob blob(4096, 256);
+  for (uint32_t idx = 0; idx < 1024; idx++)
+    blob.insert_back(uint32_t{ 0 });
+
+  std::atomic<bool>        done{ false };
+  std::atomic<std::size_t> errors{ 0 };
+  std::vector<std::thread> readers;
+  std::vector<wlib::blob::BlobSnapshot> snapshots(4);
+  for (uint32_t round = 1; round <= 200; round++)
+  {
+    // Every snapshot holds the same value in all words.
+    for (std::size_t idx = 0; idx < 1024; idx++)
+      blob.overwrite<uint32_t>(4 * idx, round);
+    snapshots[round % 4] = blob.snapshot();
+    if (readers.size() < 4)
+    {
+      readers.emplace_back([snapshot = snapshots[round % 4], &done, &errors]() {
+        do
+        {
+          uint32_t const expected = snapshot.read<uint32_t>(0);
+          for (std::size_t idx = 0; idx < 1024; idx++)
+            errors += (snapshot.read<uint32_t>(4 * idx) == expected) ? 0 : 1;
+        } while (!done.load());
+      });
+    }
+  }
+  done = true;
+  for (std::thread& reader : readers)
+    reader.join();
+  REQUIRE(errors == 0);
+  REQUIRE(blob.read<uint32_t>(4092) == 200);
+}
@@ -0,0 +1,113 @@
+#include <ut_catch.hpp>
+#include <wlib-BLOB_Stuffing.hpp>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace
+{
+  std::vector<std::byte> to_bytes(std::initializer_list<int> values)
+  {
+    std::vector<std::byte> result;
+    for (int value : values)
+      result.push_back(static_cast<std::byte>(value));
+    return result;
+  }
+
+  template <typename Tblob> std::vector<std::byte> used(Tblob const& blob) { return { blob.get_blob().begin(), blob.get_blob().end() }; }
+
+  static_assert(wlib::blob::cobs::max_encoded_size(0) == 2);
+  static_assert(wlib::blob::cobs::max_encoded_size(253) == 255);
+  static_assert(wlib::blob::cobs::max_encoded_size(254) == 256);
+  static_assert(wlib::blob::cobs::max_encoded_size(255) == 258);
+}    // namespace
+
+TEST_CASE("cobs reference vectors")
+{
+  wlib::blob::StaticBlob<600> blob;
+  wlib::blob::cobs::encode_back(blob, to_bytes({ 0x00 }));
+  REQUIRE(used(blob) == to_bytes({ 0x01, 0x01, 0x00 }));
+
+  blob.clear();
+  wlib::blob::cobs::encode_back(blob, to_bytes({ 0x11, 0x22, 0x00, 0x33 }));
+  REQUIRE(used(blob) == to_bytes({ 0x03, 0x11, 0x22, 0x02, 0x33, 0x00 }));
+
+  std::vector<std::byte> long_run(255);
+  for (std::size_t i = 0; i < long_run.size(); i++)
+    long_run[i] = static_cast<std::byte>(i + 1);
+  blob.clear();
+  wlib::blob::cobs::encode_back(blob, std::span<std::byte const>(long_run).first(254));
+  REQUIRE(blob.get_number_of_used_bytes() == 256);
+  REQUIRE(blob.read_front<uint8_t>() == 0xFF);
+  blob.clear();
+  wlib::blob::cobs::encode_back(blob, long_run);
+  REQUIRE(blob.get_number_of_used_bytes() == wlib::blob::cobs::max_encoded_size(255));
+  REQUIRE(blob.read<uint8_t>(255) == 0x02);
+
+  wlib::blob::cobs::decode_in_place(blob);
+  REQUIRE(used(blob) == long_run);
+
+  wlib::blob::StaticBlob<8> small;
+  REQUIRE_FALSE(wlib::blob::cobs::try_decode_back(small, to_bytes({ 0x05, 0x11, 0x00 })));
+  REQUIRE_FALSE(wlib::blob::cobs::try_decode_back(small, to_bytes({ 0x03, 0x11, 0x00, 0x22 })));
+  REQUIRE_THROWS(wlib::blob::cobs::decode_back(small, to_bytes({ 0x00 })));
+  REQUIRE_THROWS(wlib::blob::cobs::encode_back(small, long_run));
+}
+
+TEST_CASE("slip reference vectors")
+{
+  wlib::blob::StaticBlob<32> blob;
+  wlib::blob::slip::encode_back(blob, to_bytes({ 0x01, 0xC0, 0x02, 0xDB, 0x03 }));
+  REQUIRE(used(blob) == to_bytes({ 0x01, 0xDB, 0xDC, 0x02, 0xDB, 0xDD, 0x03, 0xC0 }));
+
+  wlib::blob::StaticBlob<32> decoded;
+  wlib::blob::slip::decode_back(decoded, blob.get_blob());
+  REQUIRE(used(decoded) == to_bytes({ 0x01, 0xC0, 0x02, 0xDB, 0x03 }));
+
+  wlib::blob::slip::decode_in_place(blob);
+  REQUIRE(used(blob) == used(decoded));
+
+  REQUIRE_FALSE(wlib::blob::slip::try_decode_back(decoded, to_bytes({ 0x01, 0xDB, 0x01, 0xC0 })));
+  REQUIRE_FALSE(wlib::blob::slip::try_decode_back(decoded, to_bytes({ 0x01, 0xC0, 0x01, 0xC0 })));
+  REQUIRE_FALSE(wlib::blob::slip::try_decode_back(decoded, to_bytes({ 0x01, 0xDB })));
+  REQUIRE(decoded.get_number_of_used_bytes() == 5);
+
+  // Leading END bytes are skipped.
+  decoded.clear();
+  wlib::blob::slip::decode_back(decoded, to_bytes({ 0xC0, 0x41, 0xC0 }));
+  REQUIRE(used(decoded) == to_bytes({ 0x41 }));
+  blob.clear();
+  blob.insert_back(std::span<std::byte const>(to_bytes({ 0xC0, 0xC0, 0x41, 0xDB, 0xDC, 0xC0 })));
+  wlib::blob::slip::decode_in_place(blob);
+  REQUIRE(used(blob) == to_bytes({ 0x41, 0xC0 }));
+}
+
+TEST_CASE("stuffing round trip")
+{
+  std::mt19937 rng(7);
+  for (std::size_t size : { 0, 1, 31, 253, 254, 255, 508, 3000 })
+  {
+    std::vector<std::byte> payload(size);
+    for (std::byte& value : payload)
+      value = static_cast<std::byte>((rng() % 4 == 0) ? 0xC0 : rng() % 200);
+
+    std::vector<std::byte> raw(std::max(wlib::blob::slip::max_encoded_size(size), wlib::blob::cobs::max_encoded_size(size)));
+    wlib::blob::MemoryBlob frame(raw.data(), raw.size());
+    wlib::blob::cobs::encode_back(frame, payload);
+    REQUIRE(frame.get_number_of_used_bytes() <= wlib::blob::cobs::max_encoded_size(size));
+    REQUIRE(frame.read_back<uint8_t>() == 0);
+    wlib::blob::cobs::decode_in_place(frame);
+    REQUIRE(used(frame) == payload);
+
+    frame.clear();
+    wlib::blob::slip::encode_back(frame, payload);
+    wlib::blob::slip::decode_in_place(frame);
+    REQUIRE(used(frame) == payload);
+
+    // Without zero bytes the COBS size is exact.
+    frame.clear();
+    wlib::blob::cobs::encode_back(frame, std::vector<std::byte>(size, std::byte(0x55)));
+    REQUIRE(frame.get_number_of_used_bytes() == wlib::blob::cobs::max_encoded_size(size));
+  }
+}
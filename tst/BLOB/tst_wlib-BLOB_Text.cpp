@@ -0,0 +1,178 @@
+#include <ut_catch.hpp>
+#include <wlib-BLOB_Text.hpp>
+
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+  std::span<std::byte const> as_bytes(std::string_view const& text) noexcept { return std::as_bytes(std::span<char const>(text.data(), text.size())); }
+
+  template <typename Tblob> std::string_view as_text(wlib::blob::Blob_Interface<Tblob> const& blob) noexcept
+  {
+    return std::string_view(reinterpret_cast<char const*>(blob.get_blob().data()), blob.get_number_of_used_bytes());
+  }
+}    // namespace
+
+TEST_CASE("hex encoding and decoding")
+{
+  wlib::blob::StaticBlob<64> text;
+  std::byte const            raw[]{ std::byte(0x00), std::byte(0x9F), std::byte(0xA5), std::byte(0xFF) };
+  wlib::blob::hex::encode_back(text, raw);
+  REQUIRE(as_text(text) == "009fa5ff");
+  wlib::blob::hex::encode_back(text, raw, wlib::blob::letter_case::upper);
+  REQUIRE(as_text(text) == "009fa5ff009FA5FF");
+
+  wlib::blob::StaticBlob<8> bytes;
+  REQUIRE(wlib::blob::hex::decoded_size(as_text(text)) == 8);
+  wlib::blob::hex::decode_back(bytes, as_text(text));
+  REQUIRE(bytes.read<uint32_t>(0, std::endian::big) == 0x009F'A5FF);
+  REQUIRE(bytes.read<uint32_t>(4, std::endian::big) == 0x009F'A5FF);
+
+  bytes.clear();
+  REQUIRE_FALSE(wlib::blob::hex::try_decode_back(bytes, "0a 1b"));
+  REQUIRE_FALSE(wlib::blob::hex::try_decode_back(bytes, "0a1"));
+  REQUIRE_FALSE(wlib::blob::hex::try_decode_back(bytes, "0g"));
+  REQUIRE_FALSE(wlib::blob::hex::try_decode_back(bytes, "000102030405060708"));
+  REQUIRE(bytes.get_number_of_used_bytes() == 0);
+  REQUIRE_THROWS(wlib::blob::hex::decode_back(bytes, "zz"));
+
+  std::string_view const spaced = " 0a 1B\n2c\t3d ";
+  REQUIRE(wlib::blob::hex::decoded_size(spaced, wlib::blob::text_validation::lenient) == 4);
+  wlib::blob::hex::decode_back(bytes, spaced, wlib::blob::text_validation::lenient);
+  REQUIRE(bytes.read<uint32_t>(0, std::endian::big) == 0x0A1B'2C3D);
+  REQUIRE_FALSE(wlib::blob::hex::try_decode_back(bytes, "0 a 1", wlib::blob::text_validation::lenient));
+
+  wlib::blob::StaticBlob<7> small;
+  REQUIRE_FALSE(wlib::blob::hex::try_encode_back(small, raw));
+  REQUIRE_THROWS(wlib::blob::hex::encode_back(small, raw));
+}
+
+TEST_CASE("base64 test vectors")
+{
+  std::pair<std::string_view, std::string_view> const vectors[]{
+    { "", "" },         { "f", "Zg==" },         { "fo", "Zm8=" },         { "foo", "Zm9v" },
+    { "foob", "Zm9vYg==" }, { "fooba", "Zm9vYmE=" }, { "foobar", "Zm9vYmFy" },
+  };
+  for (auto const& [plain, encoded] : vectors)
+  {
+    wlib::blob::StaticBlob<16> text;
+    wlib::blob::base64::encode_back(text, as_bytes(plain));
+    REQUIRE(as_text(text) == encoded);
+    REQUIRE(wlib::blob::base64::encoded_size(plain.size()) == encoded.size());
+    REQUIRE(wlib::blob::base64::decoded_size(encoded) == plain.size());
+
+    wlib::blob::StaticBlob<16> bytes;
+    wlib::blob::base64::decode_back(bytes, encoded);
+    REQUIRE(as_text(bytes) == plain);
+  }
+
+  std::string_view const all = "+/+/ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  wlib::blob::StaticBlob<64> bytes;
+  wlib::blob::base64::decode_back(bytes, all);
+  REQUIRE(bytes.get_number_of_used_bytes() == 51);
+  wlib::blob::StaticBlob<68> text;
+  wlib::blob::base64::encode_back(text, bytes.get_blob());
+  REQUIRE(as_text(text) == all);
+}
+
+TEST_CASE("base64 strict and lenient validation")
+{
+  using wlib::blob::text_validation;
+  wlib::blob::StaticBlob<32> bytes;
+
+  REQUIRE_FALSE(wlib::blob::base64::try_decode_back(bytes, "Zm9vYg"));
+  REQUIRE_FALSE(wlib::blob::base64::try_decode_back(bytes, "Zm9v Yg=="));
+  REQUIRE_FALSE(wlib::blob::base64::try_decode_back(bytes, "Zm9vYh=="));    // non-zero trailing bits
+  REQUIRE_FALSE(wlib::blob::base64::try_decode_back(bytes, "Zm9vYg="));
+  REQUIRE_FALSE(wlib::blob::base64::try_decode_back(bytes, "Zm9vYg===="));
+  REQUIRE_FALSE(wlib::blob::base64::try_decode_back(bytes, "Zm9vY==="));
+  REQUIRE_FALSE(wlib::blob::base64::try_decode_back(bytes, "Zm=9"));
+  REQUIRE_FALSE(wlib::blob::base64::try_decode_back(bytes, "Zm9v*g=="));
+  REQUIRE_FALSE(wlib::blob::base64::try_decode_back(bytes, "Zm9vY", text_validation::lenient));
+  REQUIRE(bytes.get_number_of_used_bytes() == 0);
+  REQUIRE_THROWS(wlib::blob::base64::decode_back(bytes, "Zg="));
+
+  std::string_view const spaced = "Zm9v\r\nYmFy\n Zm8 ";
+  REQUIRE(wlib::blob::base64::decoded_size(spaced, text_validation::lenient) == 8);
+  wlib::blob::base64::decode_back(bytes, spaced, text_validation::lenient);
+  REQUIRE(as_text(bytes) == "foobarfo");
+
+  bytes.clear();
+  wlib::blob::base64::decode_back(bytes, "Zm9vYg= \n", text_validation::lenient);
+  REQUIRE(as_text(bytes) == "foob");
+  REQUIRE(wlib::blob::base64::decoded_size("Zm9vYh", text_validation::lenient) == 4);
+  bytes.clear();
+  wlib::blob::base64::decode_back(bytes, "Zm9vYh", text_validation::lenient);
+  REQUIRE(as_text(bytes) == "foob");
+
+  wlib::blob::StaticBlob<5> small;
+  REQUIRE_FALSE(wlib::blob::base64::try_decode_back(small, "Zm9vYmFy"));
+  REQUIRE_FALSE(wlib::blob::base64::try_encode_back(small, as_bytes("foob")));
+}
+
+TEST_CASE("hex and base64 random round trips")
+{
+  using wlib::blob::text_validation;
+  std::mt19937 rng(47);
+  for (std::size_t size = 0; size < 100; size++)
+  {
+    std::vector<std::byte> raw(size);
+    for (std::byte& value : raw)
+      value = static_cast<std::byte>(rng());
+
+    std::vector<std::byte> text_raw(2 * size + 4);
+    std::vector<std::byte> bytes_raw(size + 16);
+
+    wlib::blob::MemoryBlob text(text_raw.data(), text_raw.size());
+    wlib::blob::MemoryBlob bytes(bytes_raw.data(), size);
+    wlib::blob::hex::encode_back(text, raw, (size % 2) ? wlib::blob::letter_case::upper : wlib::blob::letter_case::lower);
+    REQUIRE(text.get_number_of_used_bytes() == wlib::blob::hex::encoded_size(size));
+    REQUIRE(wlib::blob::hex::decoded_size(as_text(text)) == size);
+    wlib::blob::hex::decode_back(bytes, as_text(text));
+    REQUIRE(std::equal(raw.begin(), raw.end(), bytes_raw.begin()));
+
+    text.clear();
+    bytes.clear();
+    wlib::blob::base64::encode_back(text, raw);
+    REQUIRE(text.get_number_of_used_bytes() == wlib::blob::base64::encoded_size(size));
+    REQUIRE(wlib::blob::base64::decoded_size(as_text(text)) == size);
+    wlib::blob::base64::decode_back(bytes, as_text(text));
+    REQUIRE(std::equal(raw.begin(), raw.end(), bytes_raw.begin()));
+    REQUIRE(bytes.get_number_of_free_bytes() == 0);
+
+    // A broken character in any block position is rejected.
+    if (size >= 3)
+    {
+      text_raw[rng() % text.get_number_of_used_bytes() / 4 * 4] = std::byte('?');
+      bytes.clear();
+      REQUIRE_FALSE(wlib::blob::base64::try_decode_back(bytes, as_text(text), text_validation::lenient));
+    }
+  }
+}
+
+TEST_CASE("base64 line wrapped input")
+{
+  // 76 character lines mix vector blocks with whitespace handled byte by byte.
+  std::mt19937           rng(470);
+  std::vector<std::byte> raw(3000);
+  for (std::byte& value : raw)
+    value = static_cast<std::byte>(rng());
+
+  std::vector<std::byte> text_raw(wlib::blob::base64::encoded_size(raw.size()));
+  wlib::blob::MemoryBlob text(text_raw.data(), text_raw.size());
+  wlib::blob::base64::encode_back(text, raw);
+
+  std::string wrapped;
+  for (std::size_t idx = 0; idx < text.get_number_of_used_bytes(); idx += 76)
+    wrapped.append(as_text(text).substr(idx, 76)).append("\r\n");
+
+  std::vector<std::byte> bytes_raw(raw.size());
+  wlib::blob::MemoryBlob bytes(bytes_raw.data(), bytes_raw.size());
+  REQUIRE_FALSE(wlib::blob::base64::try_decode_back(bytes, wrapped));
+  REQUIRE(wlib::blob::base64::decoded_size(wrapped, wlib::blob::text_validation::lenient) == raw.size());
+  wlib::blob::base64::decode_back(bytes, wrapped, wlib::blob::text_validation::lenient);
+  REQUIRE(bytes_raw == raw);
+}
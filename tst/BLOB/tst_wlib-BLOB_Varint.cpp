@@ -0,0 +1,142 @@
+#include <ut_catch.hpp>
+#include <wlib-BLOB_Varint.hpp>
+
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+  constexpr std::size_t encoded_size(uint64_t value)
+  {
+    std::byte raw[10]{};
+    return wlib::blob::varint::encode(raw, value);
+  }
+}    // namespace
+
+TEST_CASE("varint encoding")
+{
+  static_assert(encoded_size(0) == 1);
+  static_assert(encoded_size(127) == 1);
+  static_assert(encoded_size(128) == 2);
+  static_assert(encoded_size(std::numeric_limits<uint64_t>::max()) == 10);
+  static_assert(wlib::blob::varint::max_size_v<uint32_t> == 5);
+  static_assert(wlib::blob::varint::max_size_v<int8_t> == 2);
+
+  static_assert(wlib::blob::varint::zigzag_encode(0) == 0U);
+  static_assert(wlib::blob::varint::zigzag_encode(-1) == 1U);
+  static_assert(wlib::blob::varint::zigzag_encode(1) == 2U);
+  static_assert(wlib::blob::varint::zigzag_encode(std::numeric_limits<int32_t>::min()) == 0xFFFF'FFFFU);
+  static_assert(wlib::blob::varint::zigzag_encode(static_cast<int8_t>(-64)) == 127U);
+  static_assert(wlib::blob::varint::zigzag_decode(0xFFFF'FFFEU) == std::numeric_limits<int32_t>::max());
+  static_assert(wlib::blob::varint::zigzag_decode(static_cast<uint16_t>(3)) == -2);
+
+  static_assert(wlib::blob::varint::size(300U) == 2);
+  static_assert(wlib::blob::varint::size(-65) == 2);
+
+  std::byte raw[10]{};
+  REQUIRE(wlib::blob::varint::encode(raw, 300U) == 2);
+  REQUIRE(raw[0] == std::byte(0xAC));
+  REQUIRE(raw[1] == std::byte(0x02));
+
+  uint16_t value = 0;
+  REQUIRE(wlib::blob::varint::decode(raw, 2, value) == 2);
+  REQUIRE(value == 300);
+  REQUIRE(wlib::blob::varint::decode(raw, 1, value) == 0);
+
+  std::byte const overflow[3]{ std::byte(0xFF), std::byte(0xFF), std::byte(0x04) };
+  REQUIRE(wlib::blob::varint::decode(overflow, 3, value) == 0);
+  uint32_t wide = 0;
+  REQUIRE(wlib::blob::varint::decode(overflow, 3, wide) == 3);
+  REQUIRE(wide == 0x1'3FFF);
+}
+
+TEST_CASE("varint blob access")
+{
+  std::byte                buffer[32]{};
+  wlib::blob::MemoryBlob blob(buffer);
+
+  wlib::blob::insert_varint_back(blob, 300U);
+  wlib::blob::insert_varint_back(blob, static_cast<int64_t>(-3));
+  wlib::blob::insert_varint_back(blob, std::numeric_limits<uint64_t>::max());
+  REQUIRE(blob.get_number_of_used_bytes() == 13);
+
+  std::size_t offset = 0;
+  REQUIRE(wlib::blob::read_varint<uint32_t>(blob, offset) == 300);
+  REQUIRE(wlib::blob::read_varint<int8_t>(blob, offset) == -3);
+  REQUIRE(offset == 3);
+  uint32_t narrow = 0;
+  REQUIRE_FALSE(wlib::blob::try_read_varint(blob, offset, narrow));
+  REQUIRE(offset == 3);
+  REQUIRE(wlib::blob::read_varint<uint64_t>(blob, offset) == std::numeric_limits<uint64_t>::max());
+  REQUIRE_THROWS(wlib::blob::read_varint<uint64_t>(blob, offset));
+
+  REQUIRE(wlib::blob::extract_varint_front<uint16_t>(blob) == 300);
+  REQUIRE(blob.get_number_of_used_bytes() == 11);
+
+  wlib::blob::StaticBlob<4> small;
+  REQUIRE_FALSE(wlib::blob::try_insert_varint_back(small, std::numeric_limits<uint32_t>::max()));
+  REQUIRE(small.get_number_of_used_bytes() == 0);
+  REQUIRE_THROWS(wlib::blob::insert_varint_back(small, std::span<uint16_t const>(std::array<uint16_t, 2>{ 0x4000, 0x4000 })));
+  REQUIRE(small.get_number_of_used_bytes() == 0);
+}
+
+TEMPLATE_TEST_CASE("varint bulk access", "", uint16_t, uint32_t, uint64_t, int32_t, int64_t)
+{
+  constexpr std::size_t number_of_values = 203;
+
+  TestType values_in[number_of_values]{};
+  for (std::size_t i = 0; i < number_of_values; i++)
+  {
+    uint64_t const magnitude = (i % 7 == 0) ? (i * 0x9E37'79B9) : ((i % 3 == 0) ? (i * 131) : (i % 50));
+    values_in[i]             = static_cast<TestType>((i % 2 == 0) ? magnitude : (0 - magnitude));
+  }
+
+  std::byte              buffer[number_of_values * wlib::blob::varint::max_size_v<TestType> + 1]{};
+  wlib::blob::MemoryBlob blob(buffer);
+  wlib::blob::insert_varint_back(blob, std::span<TestType const>(values_in));
+  blob.insert_back(std::byte(0xAA));
+
+  std::size_t offset = 0;
+  for (std::size_t i = 0; i < number_of_values; i++)
+    REQUIRE(wlib::blob::read_varint<TestType>(blob, offset) == values_in[i]);
+  std::size_t const expected_offset = offset;
+
+  TestType values_out[number_of_values]{};
+  offset = 0;
+  wlib::blob::read_varint(blob, offset, std::span<TestType>(values_out));
+  REQUIRE(offset == expected_offset);
+  for (std::size_t i = 0; i < number_of_values; i++)
+    REQUIRE(values_out[i] == values_in[i]);
+
+  offset = 1;
+  REQUIRE(wlib::blob::try_read_varint(blob, offset, std::span<TestType>(values_out).first(number_of_values - 1)));
+  REQUIRE_FALSE(wlib::blob::try_read_varint(blob, offset, std::span<TestType>(values_out).first(2)));
+
+  blob.remove_back(2);
+  offset = 0;
+  REQUIRE_FALSE(wlib::blob::try_read_varint(blob, offset, std::span<TestType>(values_out)));
+  REQUIRE(offset == 0);
+}
+
+TEST_CASE("varint bulk decode of mixed short values")
+{
+  // Mostly one and two byte varints, so every continuation mask pattern reaches the block decoder.
+  std::mt19937          rng(32);
+  std::vector<uint32_t> values_in(5000);
+  for (uint32_t& value : values_in)
+  {
+    uint32_t const kind = rng() % 16;
+    value               = (kind < 7) ? (rng() % 0x80) : ((kind < 14) ? (rng() % 0x4000) : rng());
+  }
+
+  std::vector<std::byte> buffer(values_in.size() * wlib::blob::varint::max_size_v<uint32_t>);
+  wlib::blob::MemoryBlob blob(buffer.data(), buffer.size());
+  wlib::blob::insert_varint_back(blob, std::span<uint32_t const>(values_in));
+
+  std::vector<uint32_t> values_out(values_in.size());
+  std::size_t           offset = 0;
+  wlib::blob::read_varint(blob, offset, std::span<uint32_t>(values_out));
+  REQUIRE(offset == blob.get_number_of_used_bytes());
+  REQUIRE(values_out == values_in);
+}
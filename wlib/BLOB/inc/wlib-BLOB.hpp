@@ -2,25 +2,74 @@
 #ifndef WLIB_BLOB_HPP_INCLUDED
 #define WLIB_BLOB_HPP_INCLUDED
 
+#include <array>
 #include <bit>
 #include <concepts>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <span>
+#include <type_traits>
 
 namespace wlib::blob
 {
+  namespace error
+  {
+    void handle_overwrite_exception();
+    void handle_insert_exception();
+    void handle_remove_exception();
+    void handle_read_exception();
+    void handle_position_exception();
+  }    // namespace error
+
   template <typename T> concept ArithmeticOrByte = std::is_arithmetic_v<T> || std::is_same_v<T, std::byte>;
 
-  class MemoryBlob
+  template <ArithmeticOrByte T> [[nodiscard]] constexpr T byteswap(T const& value) noexcept
   {
-  public:
-    constexpr MemoryBlob(std::byte* begin, std::byte* end) noexcept;
-    constexpr MemoryBlob(std::byte* begin, std::byte* end, std::byte* position) noexcept;
-    constexpr MemoryBlob(std::byte* begin, std::size_t const& size, std::size_t const& position_idx = 0) noexcept;
-    constexpr MemoryBlob(std::span<std::byte>& data, std::size_t const& position_idx = 0) noexcept;
+    if constexpr (sizeof(T) == 1)
+    {
+      return value;
+    }
+    else if constexpr (sizeof(T) == 2)
+    {
+      uint16_t const raw = std::bit_cast<uint16_t>(value);
+      return std::bit_cast<T>(static_cast<uint16_t>((raw << 8) | (raw >> 8)));
+    }
+    else if constexpr (sizeof(T) == 4)
+    {
+      uint32_t const raw = std::bit_cast<uint32_t>(value);
+      return std::bit_cast<T>(((raw & 0x0000'00FF) << 24) | ((raw & 0x0000'FF00) << 8) | ((raw & 0x00FF'0000) >> 8) | ((raw & 0xFF00'0000) >> 24));
+    }
+    else if constexpr (sizeof(T) == 8)
+    {
+      uint64_t raw = std::bit_cast<uint64_t>(value);
+      raw          = ((raw & 0x0000'0000'FFFF'FFFF) << 32) | ((raw & 0xFFFF'FFFF'0000'0000) >> 32);
+      raw          = ((raw & 0x0000'FFFF'0000'FFFF) << 16) | ((raw & 0xFFFF'0000'FFFF'0000) >> 16);
+      raw          = ((raw & 0x00FF'00FF'00FF'00FF) << 8) | ((raw & 0xFF00'FF00'FF00'FF00) >> 8);
+      return std::bit_cast<T>(raw);
+    }
+    else
+    {
+      std::array<std::byte, sizeof(T)> raw = std::bit_cast<std::array<std::byte, sizeof(T)>>(value);
+      for (std::size_t idx = 0; idx < sizeof(T) / 2; idx++)
+      {
+        std::byte const tmp      = raw[idx];
+        raw[idx]                 = raw[sizeof(T) - 1 - idx];
+        raw[sizeof(T) - 1 - idx] = tmp;
+      }
+      return std::bit_cast<T>(raw);
+    }
+  }
 
-    template <std::size_t N> constexpr MemoryBlob(std::byte (&buffer)[N]) noexcept;
+  void byteswap_copy(std::byte* dst, std::byte const* src, std::size_t const& number_of_elements, std::size_t const& element_size) noexcept;
+
+  class BlobView;
+  class ConstBlobView;
 
+  template <typename Tblob>
+  class Blob_Interface
+  {
+  public:
     [[nodiscard]] constexpr std::size_t                get_total_number_of_bytes() const noexcept;
     [[nodiscard]] constexpr std::size_t                get_number_of_free_bytes() const noexcept;
     [[nodiscard]] constexpr std::size_t                get_number_of_used_bytes() const noexcept;
@@ -30,67 +79,69 @@ namespace wlib::blob
     constexpr bool                                     try_adjust_position(std::ptrdiff_t const& offset) noexcept;
     constexpr bool                                     try_set_position(std::size_t const& position) noexcept;
 
-    bool try_overwrite(std::size_t const& offset, std::byte const* begin, std::size_t const& number_of_bytes) noexcept;
-    bool try_overwrite_reverse(std::size_t const& offset, std::byte const* begin, std::size_t const& number_of_bytes) noexcept;
-
-    bool try_overwrite(std::size_t const& offset, std::byte const& byte) noexcept;
-    bool try_overwrite(std::size_t const& offset, std::byte const* begin, std::byte const* end) noexcept;
-    bool try_overwrite(std::size_t const& offset, std::span<std::byte> const& data) noexcept;
-    bool try_overwrite_back(std::byte const& byte) noexcept;
-    bool try_overwrite_back(std::byte const* begin, std::byte const* end) noexcept;
-    bool try_overwrite_back(std::byte const* begin, std::size_t const& number_of_bytes) noexcept;
-    bool try_overwrite_back(std::span<std::byte> const& data) noexcept;
-    bool try_overwrite_front(std::byte const& byte) noexcept;
-    bool try_overwrite_front(std::byte const* begin, std::byte const* end) noexcept;
-    bool try_overwrite_front(std::byte const* begin, std::size_t const& number_of_bytes) noexcept;
-    bool try_overwrite_front(std::span<std::byte> const& data) noexcept;
-
-    bool try_overwrite_reverse(std::size_t const& offset, std::byte const& byte) noexcept;
-    bool try_overwrite_reverse(std::size_t const& offset, std::byte const* begin, std::byte const* end) noexcept;
-    bool try_overwrite_reverse(std::size_t const& offset, std::span<std::byte> const& data) noexcept;
-    bool try_overwrite_back_reverse(std::byte const& byte) noexcept;
-    bool try_overwrite_back_reverse(std::byte const* begin, std::byte const* end) noexcept;
-    bool try_overwrite_back_reverse(std::byte const* begin, std::size_t const& number_of_bytes) noexcept;
-    bool try_overwrite_back_reverse(std::span<std::byte> const& data) noexcept;
-    bool try_overwrite_front_reverse(std::byte const& byte) noexcept;
-    bool try_overwrite_front_reverse(std::byte const* begin, std::byte const* end) noexcept;
-    bool try_overwrite_front_reverse(std::byte const* begin, std::size_t const& number_of_bytes) noexcept;
-    bool try_overwrite_front_reverse(std::span<std::byte> const& data) noexcept;
-
-    template <ArithmeticOrByte T> bool try_overwrite(std::size_t const& offset, T const& value, std::endian endian = std::endian::native) noexcept;
-    template <ArithmeticOrByte T> bool try_overwrite_back(T const& value, std::endian endian = std::endian::native) noexcept;
-    template <ArithmeticOrByte T> bool try_overwrite_front(T const& value, std::endian endian = std::endian::native) noexcept;
-
-    bool try_insert(std::size_t const& offset, std::byte const* begin, std::size_t const& number_of_bytes) noexcept;
-    bool try_insert_reverse(std::size_t const& offset, std::byte const* begin, std::size_t const& number_of_bytes) noexcept;
-
-    bool try_insert(std::size_t const& offset, std::byte const& byte) noexcept;
-    bool try_insert(std::size_t const& offset, std::byte const* begin, std::byte const* end) noexcept;
-    bool try_insert(std::size_t const& offset, std::span<std::byte> const& data) noexcept;
-    bool try_insert_back(std::byte const& byte) noexcept;
-    bool try_insert_back(std::byte const* begin, std::byte const* end) noexcept;
-    bool try_insert_back(std::byte const* begin, std::size_t const& number_of_bytes) noexcept;
-    bool try_insert_back(std::span<std::byte> const& data) noexcept;
-    bool try_insert_front(std::byte const& byte) noexcept;
-    bool try_insert_front(std::byte const* begin, std::byte const* end) noexcept;
-    bool try_insert_front(std::byte const* begin, std::size_t const& number_of_bytes) noexcept;
-    bool try_insert_front(std::span<std::byte> const& data) noexcept;
-
-    bool try_insert_reverse(std::size_t const& offset, std::byte const& byte) noexcept;
-    bool try_insert_reverse(std::size_t const& offset, std::byte const* begin, std::byte const* end) noexcept;
-    bool try_insert_reverse(std::size_t const& offset, std::span<std::byte> const& data) noexcept;
-    bool try_insert_back_reverse(std::byte const& byte) noexcept;
-    bool try_insert_back_reverse(std::byte const* begin, std::byte const* end) noexcept;
-    bool try_insert_back_reverse(std::byte const* begin, std::size_t const& number_of_bytes) noexcept;
-    bool try_insert_back_reverse(std::span<std::byte> const& data) noexcept;
-    bool try_insert_front_reverse(std::byte const& byte) noexcept;
-    bool try_insert_front_reverse(std::byte const* begin, std::byte const* end) noexcept;
-    bool try_insert_front_reverse(std::byte const* begin, std::size_t const& number_of_bytes) noexcept;
-    bool try_insert_front_reverse(std::span<std::byte> const& data) noexcept;
-
-    template <ArithmeticOrByte T> bool try_insert(std::size_t const& offset, T const& value, std::endian endian = std::endian::native) noexcept;
-    template <ArithmeticOrByte T> bool try_insert_back(T const& value, std::endian endian = std::endian::native) noexcept;
-    template <ArithmeticOrByte T> bool try_insert_front(T const& value, std::endian endian = std::endian::native) noexcept;
+    constexpr bool try_overwrite(std::size_t const& offset, std::byte const* begin, std::size_t const& number_of_bytes) noexcept;
+    constexpr bool try_overwrite_reverse(std::size_t const& offset, std::byte const* begin, std::size_t const& number_of_bytes) noexcept;
+
+    constexpr bool try_overwrite(std::size_t const& offset, std::byte const& byte) noexcept;
+    constexpr bool try_overwrite(std::size_t const& offset, std::byte const* begin, std::byte const* end) noexcept;
+    constexpr bool try_overwrite(std::size_t const& offset, std::span<std::byte> const& data) noexcept;
+    constexpr bool try_overwrite_back(std::byte const& byte) noexcept;
+    constexpr bool try_overwrite_back(std::byte const* begin, std::byte const* end) noexcept;
+    constexpr bool try_overwrite_back(std::byte const* begin, std::size_t const& number_of_bytes) noexcept;
+    constexpr bool try_overwrite_back(std::span<std::byte> const& data) noexcept;
+    constexpr bool try_overwrite_front(std::byte const& byte) noexcept;
+    constexpr bool try_overwrite_front(std::byte const* begin, std::byte const* end) noexcept;
+    constexpr bool try_overwrite_front(std::byte const* begin, std::size_t const& number_of_bytes) noexcept;
+    constexpr bool try_overwrite_front(std::span<std::byte> const& data) noexcept;
+
+    constexpr bool try_overwrite_reverse(std::size_t const& offset, std::byte const& byte) noexcept;
+    constexpr bool try_overwrite_reverse(std::size_t const& offset, std::byte const* begin, std::byte const* end) noexcept;
+    constexpr bool try_overwrite_reverse(std::size_t const& offset, std::span<std::byte> const& data) noexcept;
+    constexpr bool try_overwrite_back_reverse(std::byte const& byte) noexcept;
+    constexpr bool try_overwrite_back_reverse(std::byte const* begin, std::byte const* end) noexcept;
+    constexpr bool try_overwrite_back_reverse(std::byte const* begin, std::size_t const& number_of_bytes) noexcept;
+    constexpr bool try_overwrite_back_reverse(std::span<std::byte> const& data) noexcept;
+    constexpr bool try_overwrite_front_reverse(std::byte const& byte) noexcept;
+    constexpr bool try_overwrite_front_reverse(std::byte const* begin, std::byte const* end) noexcept;
+    constexpr bool try_overwrite_front_reverse(std::byte const* begin, std::size_t const& number_of_bytes) noexcept;
+    constexpr bool try_overwrite_front_reverse(std::span<std::byte> const& data) noexcept;
+
+    template <ArithmeticOrByte T> constexpr bool try_overwrite(std::size_t const& offset, T const& value, std::endian endian = std::endian::native) noexcept;
+    template <ArithmeticOrByte T> constexpr bool try_overwrite_back(T const& value, std::endian endian = std::endian::native) noexcept;
+    template <ArithmeticOrByte T> constexpr bool try_overwrite_front(T const& value, std::endian endian = std::endian::native) noexcept;
+
+    constexpr bool try_insert(std::size_t const& offset, std::byte const* begin, std::size_t const& number_of_bytes) noexcept;
+    constexpr bool try_insert_reverse(std::size_t const& offset, std::byte const* begin, std::size_t const& number_of_bytes) noexcept;
+
+    constexpr bool try_insert(std::size_t const& offset, std::byte const& byte) noexcept;
+    constexpr bool try_insert(std::size_t const& offset, std::byte const* begin, std::byte const* end) noexcept;
+    constexpr bool try_insert(std::size_t const& offset, std::span<std::byte> const& data) noexcept;
+    constexpr bool try_insert_back(std::byte const& byte) noexcept;
+    constexpr bool try_insert_back(std::byte const* begin, std::byte const* end) noexcept;
+    constexpr bool try_insert_back(std::byte const* begin, std::size_t const& number_of_bytes) noexcept;
+    constexpr bool try_insert_back(std::span<std::byte> const& data) noexcept;
+    constexpr bool try_insert_front(std::byte const& byte) noexcept;
+    constexpr bool try_insert_front(std::byte const* begin, std::byte const* end) noexcept;
+    constexpr bool try_insert_front(std::byte const* begin, std::size_t const& number_of_bytes) noexcept;
+    constexpr bool try_insert_front(std::span<std::byte> const& data) noexcept;
+
+    constexpr bool try_insert_reverse(std::size_t const& offset, std::byte const& byte) noexcept;
+    constexpr bool try_insert_reverse(std::size_t const& offset, std::byte const* begin, std::byte const* end) noexcept;
+    constexpr bool try_insert_reverse(std::size_t const& offset, std::span<std::byte> const& data) noexcept;
+    constexpr bool try_insert_back_reverse(std::byte const& byte) noexcept;
+    constexpr bool try_insert_back_reverse(std::byte const* begin, std::byte const* end) noexcept;
+    constexpr bool try_insert_back_reverse(std::byte const* begin, std::size_t const& number_of_bytes) noexcept;
+    constexpr bool try_insert_back_reverse(std::span<std::byte> const& data) noexcept;
+    constexpr bool try_insert_front_reverse(std::byte const& byte) noexcept;
+    constexpr bool try_insert_front_reverse(std::byte const* begin, std::byte const* end) noexcept;
+    constexpr bool try_insert_front_reverse(std::byte const* begin, std::size_t const& number_of_bytes) noexcept;
+    constexpr bool try_insert_front_reverse(std::span<std::byte> const& data) noexcept;
+
+    template <ArithmeticOrByte T> constexpr bool try_insert(std::size_t const& offset, T const& value, std::endian endian = std::endian::native) noexcept;
+    template <ArithmeticOrByte T> constexpr bool try_insert_back(T const& value, std::endian endian = std::endian::native) noexcept;
+    template <ArithmeticOrByte T> constexpr bool try_insert_front(T const& value, std::endian endian = std::endian::native) noexcept;
+
+    template <ArithmeticOrByte... Ts> requires(sizeof...(Ts) > 0) constexpr bool try_insert_back(std::endian endian, Ts const&... values) noexcept;
 
     constexpr bool try_read(std::size_t const& offset, std::byte* ptr, std::size_t const& number_of_bytes) const noexcept;
     constexpr bool try_read_reverse(std::size_t const& offset, std::byte* ptr, std::size_t const& number_of_bytes) const noexcept;
@@ -100,116 +151,320 @@ namespace wlib::blob
     constexpr bool try_read_back_reverse(std::byte* ptr, std::size_t const& number_of_bytes) const noexcept;
     constexpr bool try_read_front_reverse(std::byte* ptr, std::size_t const& number_of_bytes) const noexcept;
 
-    template <ArithmeticOrByte T> bool try_read(std::size_t const& offset, T& value, std::endian endian = std::endian::native) const noexcept;
-    template <ArithmeticOrByte T> bool try_read_back(T& value, std::endian endian = std::endian::native) const noexcept;
-    template <ArithmeticOrByte T> bool try_read_front(T& value, std::endian endian = std::endian::native) const noexcept;
-
-    bool try_remove(std::size_t const& offset, std::size_t const& number_of_bytes = 1) noexcept;
-
-    bool try_remove_back(std::size_t const& number_of_bytes = 1) noexcept;
-    bool try_remove_front(std::size_t const& number_of_bytes = 1) noexcept;
-
-    template <ArithmeticOrByte T> bool try_remove(std::size_t const& offset) noexcept;
-    template <ArithmeticOrByte T> bool try_remove_back() noexcept;
-    template <ArithmeticOrByte T> bool try_remove_front() noexcept;
-
-    template <ArithmeticOrByte T> bool try_extract(std::size_t const& offset, T& value, std::endian endian = std::endian::native) noexcept;
-    template <ArithmeticOrByte T> bool try_extract_back(T& value, std::endian endian = std::endian::native) noexcept;
-    template <ArithmeticOrByte T> bool try_extract_front(T& value, std::endian endian = std::endian::native) noexcept;
-
-    void adjust_position(std::ptrdiff_t const& offset);
-    void set_position(std::size_t const& position);
-
-    void overwrite(std::size_t const& offset, std::byte const* begin, std::size_t const& number_of_bytes);
-    void overwrite_reverse(std::size_t const& offset, std::byte const* begin, std::size_t const& number_of_bytes);
-
-    void overwrite(std::size_t const& offset, std::byte const& byte);
-    void overwrite(std::size_t const& offset, std::byte const* begin, std::byte const* end);
-    void overwrite(std::size_t const& offset, std::span<std::byte> const& data);
-    void overwrite_back(std::byte const& byte);
-    void overwrite_back(std::byte const* begin, std::byte const* end);
-    void overwrite_back(std::byte const* begin, std::size_t const& number_of_bytes);
-    void overwrite_back(std::span<std::byte> const& data);
-    void overwrite_front(std::byte const& byte);
-    void overwrite_front(std::byte const* begin, std::byte const* end);
-    void overwrite_front(std::byte const* begin, std::size_t const& number_of_bytes);
-    void overwrite_front(std::span<std::byte> const& data);
-
-    void overwrite_reverse(std::size_t const& offset, std::byte const& byte);
-    void overwrite_reverse(std::size_t const& offset, std::byte const* begin, std::byte const* end);
-    void overwrite_reverse(std::size_t const& offset, std::span<std::byte> const& data);
-    void overwrite_back_reverse(std::byte const& byte);
-    void overwrite_back_reverse(std::byte const* begin, std::byte const* end);
-    void overwrite_back_reverse(std::byte const* begin, std::size_t const& number_of_bytes);
-    void overwrite_back_reverse(std::span<std::byte> const& data);
-    void overwrite_front_reverse(std::byte const& byte);
-    void overwrite_front_reverse(std::byte const* begin, std::byte const* end);
-    void overwrite_front_reverse(std::byte const* begin, std::size_t const& number_of_bytes);
-    void overwrite_front_reverse(std::span<std::byte> const& data);
-
-    template <ArithmeticOrByte T> void overwrite(std::size_t const& offset, T const& value, std::endian endian = std::endian::native);
-    template <ArithmeticOrByte T> void overwrite_back(T const& value, std::endian endian = std::endian::native);
-    template <ArithmeticOrByte T> void overwrite_front(T const& value, std::endian endian = std::endian::native);
-
-    void insert(std::size_t const& offset, std::byte const* begin, std::size_t const& number_of_bytes);
-    void insert_reverse(std::size_t const& offset, std::byte const* begin, std::size_t const& number_of_bytes);
-
-    void insert(std::size_t const& offset, std::byte const& byte);
-    void insert(std::size_t const& offset, std::byte const* begin, std::byte const* end);
-    void insert(std::size_t const& offset, std::span<std::byte> const& data);
-    void insert_back(std::byte const& byte);
-    void insert_back(std::byte const* begin, std::byte const* end);
-    void insert_back(std::byte const* begin, std::size_t const& number_of_bytes);
-    void insert_back(std::span<std::byte> const& data);
-    void insert_front(std::byte const& byte);
-    void insert_front(std::byte const* begin, std::byte const* end);
-    void insert_front(std::byte const* begin, std::size_t const& number_of_bytes);
-    void insert_front(std::span<std::byte> const& data);
-
-    void insert_reverse(std::size_t const& offset, std::byte const& byte);
-    void insert_reverse(std::size_t const& offset, std::byte const* begin, std::byte const* end);
-    void insert_reverse(std::size_t const& offset, std::span<std::byte> const& data);
-    void insert_back_reverse(std::byte const& byte);
-    void insert_back_reverse(std::byte const* begin, std::byte const* end);
-    void insert_back_reverse(std::byte const* begin, std::size_t const& number_of_bytes);
-    void insert_back_reverse(std::span<std::byte> const& data);
-    void insert_front_reverse(std::byte const& byte);
-    void insert_front_reverse(std::byte const* begin, std::byte const* end);
-    void insert_front_reverse(std::byte const* begin, std::size_t const& number_of_bytes);
-    void insert_front_reverse(std::span<std::byte> const& data);
-
-    template <ArithmeticOrByte T> void insert(std::size_t const& offset, T const& value, std::endian endian = std::endian::native);
-    template <ArithmeticOrByte T> void insert_back(T const& value, std::endian endian = std::endian::native);
-    template <ArithmeticOrByte T> void insert_front(T const& value, std::endian endian = std::endian::native);
-
-    void remove(std::size_t const& offset, std::size_t const& number_of_bytes = 1);
-    void remove_back(std::size_t const& number_of_bytes = 1);
-    void remove_front(std::size_t const& number_of_bytes = 1);
-
-    template <ArithmeticOrByte T> [[nodiscard]] T read(std::size_t const& offset, std::endian endian = std::endian::native) const;
-    template <ArithmeticOrByte T> [[nodiscard]] T read_back(std::endian endian = std::endian::native) const;
-    template <ArithmeticOrByte T> [[nodiscard]] T read_front(std::endian endian = std::endian::native) const;
-
-    template <ArithmeticOrByte T> [[nodiscard]] T extract(std::size_t const& offset, std::endian endian = std::endian::native);
-    template <ArithmeticOrByte T> [[nodiscard]] T extract_back(std::endian endian = std::endian::native);
-    template <ArithmeticOrByte T> [[nodiscard]] T extract_front(std::endian endian = std::endian::native);
+    template <ArithmeticOrByte T> constexpr bool try_read(std::size_t const& offset, T& value, std::endian endian = std::endian::native) const noexcept;
+    template <ArithmeticOrByte T> constexpr bool try_read_back(T& value, std::endian endian = std::endian::native) const noexcept;
+    template <ArithmeticOrByte T> constexpr bool try_read_front(T& value, std::endian endian = std::endian::native) const noexcept;
+
+    template <ArithmeticOrByte... Ts> requires(sizeof...(Ts) > 0) constexpr bool try_read(std::size_t const& offset, std::endian endian, Ts&... values) const noexcept;
+
+    constexpr bool try_remove(std::size_t const& offset, std::size_t const& number_of_bytes = 1) noexcept;
+
+    constexpr bool try_remove_back(std::size_t const& number_of_bytes = 1) noexcept;
+    constexpr bool try_remove_front(std::size_t const& number_of_bytes = 1) noexcept;
+
+    template <ArithmeticOrByte T> constexpr bool try_remove(std::size_t const& offset) noexcept;
+    template <ArithmeticOrByte T> constexpr bool try_remove_back() noexcept;
+    template <ArithmeticOrByte T> constexpr bool try_remove_front() noexcept;
+
+    template <ArithmeticOrByte T> constexpr bool try_extract(std::size_t const& offset, T& value, std::endian endian = std::endian::native) noexcept;
+    template <ArithmeticOrByte T> constexpr bool try_extract_back(T& value, std::endian endian = std::endian::native) noexcept;
+    template <ArithmeticOrByte T> constexpr bool try_extract_front(T& value, std::endian endian = std::endian::native) noexcept;
+
+    template <ArithmeticOrByte T, std::endian endian> constexpr bool try_overwrite(std::size_t const& offset, T const& value) noexcept;
+    template <ArithmeticOrByte T, std::endian endian> constexpr bool try_overwrite_back(T const& value) noexcept;
+    template <ArithmeticOrByte T, std::endian endian> constexpr bool try_overwrite_front(T const& value) noexcept;
+    template <ArithmeticOrByte T, std::endian endian> constexpr bool try_insert(std::size_t const& offset, T const& value) noexcept;
+    template <ArithmeticOrByte T, std::endian endian> constexpr bool try_insert_back(T const& value) noexcept;
+    template <ArithmeticOrByte T, std::endian endian> constexpr bool try_insert_front(T const& value) noexcept;
+    template <ArithmeticOrByte T, std::endian endian> constexpr bool try_read(std::size_t const& offset, T& value) const noexcept;
+    template <ArithmeticOrByte T, std::endian endian> constexpr bool try_read_back(T& value) const noexcept;
+    template <ArithmeticOrByte T, std::endian endian> constexpr bool try_read_front(T& value) const noexcept;
+    template <ArithmeticOrByte T, std::endian endian> constexpr bool try_extract(std::size_t const& offset, T& value) noexcept;
+    template <ArithmeticOrByte T, std::endian endian> constexpr bool try_extract_back(T& value) noexcept;
+    template <ArithmeticOrByte T, std::endian endian> constexpr bool try_extract_front(T& value) noexcept;
+
+    template <ArithmeticOrByte T> constexpr bool try_overwrite(std::size_t const& offset, std::span<T const> const& values, std::endian endian = std::endian::native) noexcept;
+    template <ArithmeticOrByte T> constexpr bool try_insert_back(std::span<T const> const& values, std::endian endian = std::endian::native) noexcept;
+    template <ArithmeticOrByte T> constexpr bool try_read(std::size_t const& offset, std::span<T> const& values, std::endian endian = std::endian::native) const noexcept;
+
+    constexpr void adjust_position(std::ptrdiff_t const& offset);
+    constexpr void set_position(std::size_t const& position);
+
+    constexpr void overwrite(std::size_t const& offset, std::byte const* begin, std::size_t const& number_of_bytes);
+    constexpr void overwrite_reverse(std::size_t const& offset, std::byte const* begin, std::size_t const& number_of_bytes);
+
+    constexpr void overwrite(std::size_t const& offset, std::byte const& byte);
+    constexpr void overwrite(std::size_t const& offset, std::byte const* begin, std::byte const* end);
+    constexpr void overwrite(std::size_t const& offset, std::span<std::byte> const& data);
+    constexpr void overwrite_back(std::byte const& byte);
+    constexpr void overwrite_back(std::byte const* begin, std::byte const* end);
+    constexpr void overwrite_back(std::byte const* begin, std::size_t const& number_of_bytes);
+    constexpr void overwrite_back(std::span<std::byte> const& data);
+    constexpr void overwrite_front(std::byte const& byte);
+    constexpr void overwrite_front(std::byte const* begin, std::byte const* end);
+    constexpr void overwrite_front(std::byte const* begin, std::size_t const& number_of_bytes);
+    constexpr void overwrite_front(std::span<std::byte> const& data);
+
+    constexpr void overwrite_reverse(std::size_t const& offset, std::byte const& byte);
+    constexpr void overwrite_reverse(std::size_t const& offset, std::byte const* begin, std::byte const* end);
+    constexpr void overwrite_reverse(std::size_t const& offset, std::span<std::byte> const& data);
+    constexpr void overwrite_back_reverse(std::byte const& byte);
+    constexpr void overwrite_back_reverse(std::byte const* begin, std::byte const* end);
+    constexpr void overwrite_back_reverse(std::byte const* begin, std::size_t const& number_of_bytes);
+    constexpr void overwrite_back_reverse(std::span<std::byte> const& data);
+    constexpr void overwrite_front_reverse(std::byte const& byte);
+    constexpr void overwrite_front_reverse(std::byte const* begin, std::byte const* end);
+    constexpr void overwrite_front_reverse(std::byte const* begin, std::size_t const& number_of_bytes);
+    constexpr void overwrite_front_reverse(std::span<std::byte> const& data);
+
+    template <ArithmeticOrByte T> constexpr void overwrite(std::size_t const& offset, T const& value, std::endian endian = std::endian::native);
+    template <ArithmeticOrByte T> constexpr void overwrite_back(T const& value, std::endian endian = std::endian::native);
+    template <ArithmeticOrByte T> constexpr void overwrite_front(T const& value, std::endian endian = std::endian::native);
+
+    constexpr void insert(std::size_t const& offset, std::byte const* begin, std::size_t const& number_of_bytes);
+    constexpr void insert_reverse(std::size_t const& offset, std::byte const* begin, std::size_t const& number_of_bytes);
+
+    constexpr void insert(std::size_t const& offset, std::byte const& byte);
+    constexpr void insert(std::size_t const& offset, std::byte const* begin, std::byte const* end);
+    constexpr void insert(std::size_t const& offset, std::span<std::byte> const& data);
+    constexpr void insert_back(std::byte const& byte);
+    constexpr void insert_back(std::byte const* begin, std::byte const* end);
+    constexpr void insert_back(std::byte const* begin, std::size_t const& number_of_bytes);
+    constexpr void insert_back(std::span<std::byte> const& data);
+    constexpr void insert_front(std::byte const& byte);
+    constexpr void insert_front(std::byte const* begin, std::byte const* end);
+    constexpr void insert_front(std::byte const* begin, std::size_t const& number_of_bytes);
+    constexpr void insert_front(std::span<std::byte> const& data);
+
+    constexpr void insert_reverse(std::size_t const& offset, std::byte const& byte);
+    constexpr void insert_reverse(std::size_t const& offset, std::byte const* begin, std::byte const* end);
+    constexpr void insert_reverse(std::size_t const& offset, std::span<std::byte> const& data);
+    constexpr void insert_back_reverse(std::byte const& byte);
+    constexpr void insert_back_reverse(std::byte const* begin, std::byte const* end);
+    constexpr void insert_back_reverse(std::byte const* begin, std::size_t const& number_of_bytes);
+    constexpr void insert_back_reverse(std::span<std::byte> const& data);
+    constexpr void insert_front_reverse(std::byte const& byte);
+    constexpr void insert_front_reverse(std::byte const* begin, std::byte const* end);
+    constexpr void insert_front_reverse(std::byte const* begin, std::size_t const& number_of_bytes);
+    constexpr void insert_front_reverse(std::span<std::byte> const& data);
+
+    template <ArithmeticOrByte T> constexpr void insert(std::size_t const& offset, T const& value, std::endian endian = std::endian::native);
+    template <ArithmeticOrByte T> constexpr void insert_back(T const& value, std::endian endian = std::endian::native);
+    template <ArithmeticOrByte T> constexpr void insert_front(T const& value, std::endian endian = std::endian::native);
+
+    template <ArithmeticOrByte... Ts> requires(sizeof...(Ts) > 0) constexpr void insert_back(std::endian endian, Ts const&... values);
+
+    constexpr void remove(std::size_t const& offset, std::size_t const& number_of_bytes = 1);
+    constexpr void remove_back(std::size_t const& number_of_bytes = 1);
+    constexpr void remove_front(std::size_t const& number_of_bytes = 1);
+
+    template <ArithmeticOrByte T> [[nodiscard]] constexpr T read(std::size_t const& offset, std::endian endian = std::endian::native) const;
+    template <ArithmeticOrByte T> [[nodiscard]] constexpr T read_back(std::endian endian = std::endian::native) const;
+    template <ArithmeticOrByte T> [[nodiscard]] constexpr T read_front(std::endian endian = std::endian::native) const;
+
+    template <ArithmeticOrByte... Ts> requires(sizeof...(Ts) > 0) constexpr void read(std::size_t const& offset, std::endian endian, Ts&... values) const;
+
+    template <ArithmeticOrByte T> [[nodiscard]] constexpr T extract(std::size_t const& offset, std::endian endian = std::endian::native);
+    template <ArithmeticOrByte T> [[nodiscard]] constexpr T extract_back(std::endian endian = std::endian::native);
+    template <ArithmeticOrByte T> [[nodiscard]] constexpr T extract_front(std::endian endian = std::endian::native);
+
+    template <ArithmeticOrByte T, std::endian endian> constexpr void            overwrite(std::size_t const& offset, T const& value);
+    template <ArithmeticOrByte T, std::endian endian> constexpr void            overwrite_back(T const& value);
+    template <ArithmeticOrByte T, std::endian endian> constexpr void            overwrite_front(T const& value);
+    template <ArithmeticOrByte T, std::endian endian> constexpr void            insert(std::size_t const& offset, T const& value);
+    template <ArithmeticOrByte T, std::endian endian> constexpr void            insert_back(T const& value);
+    template <ArithmeticOrByte T, std::endian endian> constexpr void            insert_front(T const& value);
+    template <ArithmeticOrByte T, std::endian endian> [[nodiscard]] constexpr T read(std::size_t const& offset) const;
+    template <ArithmeticOrByte T, std::endian endian> [[nodiscard]] constexpr T read_back() const;
+    template <ArithmeticOrByte T, std::endian endian> [[nodiscard]] constexpr T read_front() const;
+    template <ArithmeticOrByte T, std::endian endian> [[nodiscard]] constexpr T extract(std::size_t const& offset);
+    template <ArithmeticOrByte T, std::endian endian> [[nodiscard]] constexpr T extract_back();
+    template <ArithmeticOrByte T, std::endian endian> [[nodiscard]] constexpr T extract_front();
+
+    template <ArithmeticOrByte T> constexpr void overwrite(std::size_t const& offset, std::span<T const> const& values, std::endian endian = std::endian::native);
+    template <ArithmeticOrByte T> constexpr void insert_back(std::span<T const> const& values, std::endian endian = std::endian::native);
+    template <ArithmeticOrByte T> constexpr void read(std::size_t const& offset, std::span<T> const& values, std::endian endian = std::endian::native) const;
+
+    constexpr bool                        try_subblob(std::size_t const& offset, std::size_t const& number_of_bytes, BlobView& view) noexcept;
+    constexpr bool                        try_subblob(std::size_t const& offset, std::size_t const& number_of_bytes, ConstBlobView& view) const noexcept;
+    [[nodiscard]] constexpr BlobView      subblob(std::size_t const& offset, std::size_t const& number_of_bytes);
+    [[nodiscard]] constexpr ConstBlobView subblob(std::size_t const& offset, std::size_t const& number_of_bytes) const;
+
+    // count native endian values in place, fails if out of bounds or if the bytes at offset are not aligned for T.
+    template <ArithmeticOrByte T> bool                             try_as_span(std::size_t const& offset, std::size_t const& count, std::span<T>& view) noexcept;
+    template <ArithmeticOrByte T> bool                             try_as_span(std::size_t const& offset, std::size_t const& count, std::span<T const>& view) const noexcept;
+    template <ArithmeticOrByte T> [[nodiscard]] std::span<T const> as_span(std::size_t const& offset, std::size_t const& count) const;
+    // In place if aligned, otherwise the values are copied into buffer.
+    template <ArithmeticOrByte T> [[nodiscard]] std::span<T const> as_span(std::size_t const& offset, std::size_t const& count, std::span<T> const& buffer) const;
+
+  protected:
+    constexpr Blob_Interface(std::size_t const& position_idx = 0) noexcept
+        : m_pos_idx(position_idx)
+    {
+    }
 
   private:
-    static std::size_t data_shift_right(std::byte* data, std::size_t const& size, std::size_t const& offset, std::size_t const& shift);
-    static std::size_t data_shift_left(std::byte* data, std::size_t const& size, std::size_t const& offset, std::size_t const& shift);
+    [[nodiscard]] constexpr std::byte*       get_data() noexcept { return static_cast<Tblob*>(this)->m_data; }
+    [[nodiscard]] constexpr std::byte const* get_data() const noexcept { return static_cast<Tblob const*>(this)->m_data; }
+
+    template <ArithmeticOrByte T, std::endian endian> static constexpr void store(std::byte* dst, T const& value) noexcept;
+    template <ArithmeticOrByte T, std::endian endian> static constexpr T    load(std::byte const* src) noexcept;
+
+    template <ArithmeticOrByte T> static constexpr std::array<std::byte, sizeof(T)> to_bytes(T const& value) noexcept;
+    template <ArithmeticOrByte T> static constexpr std::size_t                      from_bytes(T& value, std::byte const* src, bool reverse) noexcept;
 
-    static std::size_t byte_copy(std::byte* dst, std::byte const* src, std::size_t const& size);
-    static std::size_t byte_copy_reverse(std::byte* dst, std::byte const* src, std::size_t const& size);
+    template <ArithmeticOrByte T> static constexpr void bulk_store(std::byte* dst, std::span<T const> const& values, std::endian endian) noexcept;
+    template <ArithmeticOrByte T> static constexpr void bulk_load(std::span<T> const& values, std::byte const* src, std::endian endian) noexcept;
+
+    static constexpr std::size_t data_shift_right(std::byte* data, std::size_t const& size, std::size_t const& offset, std::size_t const& shift);
+    static constexpr std::size_t data_shift_left(std::byte* data, std::size_t const& size, std::size_t const& offset, std::size_t const& shift);
+
+    static constexpr std::size_t byte_copy(std::byte* dst, std::byte const* src, std::size_t const& size);
+    static void                  bulk_copy(std::byte* dst, std::byte const* src, std::size_t const& number_of_elements, std::size_t const& element_size, std::endian endian);
+    static constexpr std::size_t byte_copy_reverse(std::byte* dst, std::byte const* src, std::size_t const& size);
+
+    std::size_t m_pos_idx = 0;
+  };
 
-    static void handle_overwrite_exception();
-    static void handle_insert_exception();
-    static void handle_remove_exception();
-    static void handle_read_exception();
-    static void handle_position_exception();
+  class MemoryBlob: public Blob_Interface<MemoryBlob>
+  {
+  public:
+    constexpr MemoryBlob(std::byte* begin, std::byte* end) noexcept;
+    constexpr MemoryBlob(std::byte* begin, std::byte* end, std::byte* position) noexcept;
+    constexpr MemoryBlob(std::byte* begin, std::size_t const& size, std::size_t const& position_idx = 0) noexcept;
+    constexpr MemoryBlob(std::span<std::byte>& data, std::size_t const& position_idx = 0) noexcept;
+
+    template <std::size_t N> constexpr MemoryBlob(std::byte (&buffer)[N]) noexcept;
+
+  private:
+    friend class Blob_Interface<MemoryBlob>;
 
     std::byte*  m_data;
     std::size_t m_size;
-    std::size_t m_pos_idx = 0;
+  };
+
+  // alignment > 1 lets typed views of the buffer (as_span) and vectorised code work in place.
+  template <std::size_t N, std::size_t alignment = 1> class StaticBlob: public Blob_Interface<StaticBlob<N, alignment>>
+  {
+    static_assert(N > 0, "StaticBlob needs at least one byte of storage");
+    static_assert(std::has_single_bit(alignment), "StaticBlob alignment must be a power of two");
+
+  public:
+    constexpr StaticBlob() noexcept = default;
+
+  private:
+    friend class Blob_Interface<StaticBlob<N, alignment>>;
+
+    alignas(alignment) std::byte m_data[N]{};
+    static constexpr std::size_t m_size = N;
+  };
+
+  // Fixed size window into the used bytes of another blob. Only reading and overwriting
+  // is possible, the size of the view and of the parent never changes.
+  class BlobView: private Blob_Interface<BlobView>
+  {
+    using base_t = Blob_Interface<BlobView>;
+
+  public:
+    constexpr BlobView() noexcept = default;
+    constexpr BlobView(std::byte* begin, std::size_t const& size) noexcept
+        : base_t(size)
+        , m_data(begin)
+        , m_size(size)
+    {
+    }
+
+    using base_t::get_blob;
+    using base_t::get_number_of_used_bytes;
+    using base_t::get_total_number_of_bytes;
+
+    using base_t::read;
+    using base_t::read_back;
+    using base_t::read_front;
+    using base_t::try_read;
+    using base_t::try_read_back;
+    using base_t::try_read_back_reverse;
+    using base_t::try_read_front;
+    using base_t::try_read_front_reverse;
+    using base_t::try_read_reverse;
+
+    using base_t::overwrite;
+    using base_t::overwrite_back;
+    using base_t::overwrite_back_reverse;
+    using base_t::overwrite_front;
+    using base_t::overwrite_front_reverse;
+    using base_t::overwrite_reverse;
+    using base_t::try_overwrite;
+    using base_t::try_overwrite_back;
+    using base_t::try_overwrite_back_reverse;
+    using base_t::try_overwrite_front;
+    using base_t::try_overwrite_front_reverse;
+    using base_t::try_overwrite_reverse;
+
+    using base_t::subblob;
+    using base_t::try_subblob;
+
+    using base_t::as_span;
+    using base_t::try_as_span;
+
+  private:
+    friend base_t;
+
+    std::byte*  m_data = nullptr;
+    std::size_t m_size = 0;
+  };
+
+  class ConstBlobView: private Blob_Interface<ConstBlobView>
+  {
+    using base_t = Blob_Interface<ConstBlobView>;
+
+  public:
+    constexpr ConstBlobView() noexcept = default;
+    constexpr ConstBlobView(std::byte const* begin, std::size_t const& size) noexcept
+        : base_t(size)
+        , m_data(begin)
+        , m_size(size)
+    {
+    }
+    constexpr ConstBlobView(BlobView const& view) noexcept
+        : ConstBlobView(view.get_blob().data(), view.get_number_of_used_bytes())
+    {
+    }
+
+    [[nodiscard]] constexpr std::span<std::byte const> get_blob() const noexcept { return std::span<std::byte const>(this->m_data, this->m_size); }
+    using base_t::get_number_of_used_bytes;
+    using base_t::get_total_number_of_bytes;
+
+    using base_t::read;
+    using base_t::read_back;
+    using base_t::read_front;
+    using base_t::try_read;
+    using base_t::try_read_back;
+    using base_t::try_read_back_reverse;
+    using base_t::try_read_front;
+    using base_t::try_read_front_reverse;
+    using base_t::try_read_reverse;
+
+    constexpr bool try_subblob(std::size_t const& offset, std::size_t const& number_of_bytes, ConstBlobView& view) const noexcept
+    {
+      return static_cast<base_t const&>(*this).try_subblob(offset, number_of_bytes, view);
+    }
+    [[nodiscard]] constexpr ConstBlobView subblob(std::size_t const& offset, std::size_t const& number_of_bytes) const
+    {
+      return static_cast<base_t const&>(*this).subblob(offset, number_of_bytes);
+    }
+
+    using base_t::as_span;
+    template <ArithmeticOrByte T> bool try_as_span(std::size_t const& offset, std::size_t const& count, std::span<T const>& view) const noexcept
+    {
+      return static_cast<base_t const&>(*this).try_as_span(offset, count, view);
+    }
+
+  private:
+    friend base_t;
+
+    std::byte const* m_data = nullptr;
+    std::size_t      m_size = 0;
   };
 
   template <std::size_t N>
@@ -218,197 +473,576 @@ namespace wlib::blob
   {
   }
 
-  template <ArithmeticOrByte T> inline bool MemoryBlob::try_overwrite(std::size_t const& offset, T const& value, std::endian endian) noexcept
+  template <typename Tblob>
+  template <ArithmeticOrByte T> inline constexpr bool Blob_Interface<Tblob>::try_overwrite(std::size_t const& offset, T const& value, std::endian endian) noexcept
   {
     if (endian == std::endian::native)
-      return this->try_overwrite(offset, reinterpret_cast<std::byte const*>(&value), sizeof(T));
+      return this->try_overwrite(offset, Blob_Interface::to_bytes(value).data(), sizeof(T));
     else
-      return this->try_overwrite_reverse(offset, reinterpret_cast<std::byte const*>(&value), sizeof(T));
+      return this->try_overwrite_reverse(offset, Blob_Interface::to_bytes(value).data(), sizeof(T));
   }
 
-  template <ArithmeticOrByte T> inline bool MemoryBlob::try_overwrite_back(T const& value, std::endian endian) noexcept
+  template <typename Tblob>
+  template <ArithmeticOrByte T> inline constexpr bool Blob_Interface<Tblob>::try_overwrite_back(T const& value, std::endian endian) noexcept
   {
     if (endian == std::endian::native)
-      return this->try_overwrite_back(reinterpret_cast<std::byte const*>(&value), sizeof(T));
+      return this->try_overwrite_back(Blob_Interface::to_bytes(value).data(), sizeof(T));
     else
-      return this->try_overwrite_back_reverse(reinterpret_cast<std::byte const*>(&value), sizeof(T));
+      return this->try_overwrite_back_reverse(Blob_Interface::to_bytes(value).data(), sizeof(T));
   }
 
-  template <ArithmeticOrByte T> inline bool MemoryBlob::try_overwrite_front(T const& value, std::endian endian) noexcept
+  template <typename Tblob>
+  template <ArithmeticOrByte T> inline constexpr bool Blob_Interface<Tblob>::try_overwrite_front(T const& value, std::endian endian) noexcept
   {
     if (endian == std::endian::native)
-      return this->try_overwrite_front(reinterpret_cast<std::byte const*>(&value), sizeof(T));
+      return this->try_overwrite_front(Blob_Interface::to_bytes(value).data(), sizeof(T));
     else
-      return this->try_overwrite_front_reverse(reinterpret_cast<std::byte const*>(&value), sizeof(T));
+      return this->try_overwrite_front_reverse(Blob_Interface::to_bytes(value).data(), sizeof(T));
   }
 
-  template <ArithmeticOrByte T> inline bool MemoryBlob::try_insert(std::size_t const& offset, T const& value, std::endian endian) noexcept
+  template <typename Tblob>
+  template <ArithmeticOrByte T> inline constexpr bool Blob_Interface<Tblob>::try_insert(std::size_t const& offset, T const& value, std::endian endian) noexcept
   {
     if (endian == std::endian::native)
-      return this->try_insert(offset, reinterpret_cast<std::byte const*>(&value), sizeof(value));
+      return this->try_insert(offset, Blob_Interface::to_bytes(value).data(), sizeof(value));
     else
-      return this->try_insert_reverse(offset, reinterpret_cast<std::byte const*>(&value), sizeof(value));
+      return this->try_insert_reverse(offset, Blob_Interface::to_bytes(value).data(), sizeof(value));
   }
 
-  template <ArithmeticOrByte T> inline bool MemoryBlob::try_insert_back(T const& value, std::endian endian) noexcept
+  template <typename Tblob>
+  template <ArithmeticOrByte T> inline constexpr bool Blob_Interface<Tblob>::try_insert_back(T const& value, std::endian endian) noexcept
   {
     if (endian == std::endian::native)
-      return this->try_insert_back(reinterpret_cast<std::byte const*>(&value), sizeof(value));
+      return this->try_insert_back(Blob_Interface::to_bytes(value).data(), sizeof(value));
     else
-      return this->try_insert_back_reverse(reinterpret_cast<std::byte const*>(&value), sizeof(value));
+      return this->try_insert_back_reverse(Blob_Interface::to_bytes(value).data(), sizeof(value));
   }
 
-  template <ArithmeticOrByte T> inline bool MemoryBlob::try_insert_front(T const& value, std::endian endian) noexcept
+  template <typename Tblob>
+  template <ArithmeticOrByte T> inline constexpr bool Blob_Interface<Tblob>::try_insert_front(T const& value, std::endian endian) noexcept
   {
     if (endian == std::endian::native)
-      return this->try_insert_front(reinterpret_cast<std::byte const*>(&value), sizeof(value));
+      return this->try_insert_front(Blob_Interface::to_bytes(value).data(), sizeof(value));
     else
-      return this->try_insert_front_reverse(reinterpret_cast<std::byte const*>(&value), sizeof(value));
+      return this->try_insert_front_reverse(Blob_Interface::to_bytes(value).data(), sizeof(value));
   }
 
-  template <ArithmeticOrByte T> inline bool MemoryBlob::try_read(std::size_t const& offset, T& value, std::endian endian) const noexcept
+  template <typename Tblob>
+  template <ArithmeticOrByte... Ts> requires(sizeof...(Ts) > 0) inline constexpr bool Blob_Interface<Tblob>::try_insert_back(std::endian endian, Ts const&... values) noexcept
   {
+    constexpr std::size_t number_of_bytes = (sizeof(Ts) + ...);
+    if (this->get_number_of_free_bytes() < number_of_bytes)
+      return false;
+
+    std::byte* dst = &this->get_data()[this->m_pos_idx];
     if (endian == std::endian::native)
-    {
-      return this->try_read(offset, reinterpret_cast<std ::byte*>(&value), sizeof(value));
-    }
+      ((dst += Blob_Interface::byte_copy(dst, Blob_Interface::to_bytes(values).data(), sizeof(Ts))), ...);
     else
-    {
-      return this->try_read_reverse(offset, reinterpret_cast<std ::byte*>(&value), sizeof(value));
-    }
+      ((dst += Blob_Interface::byte_copy_reverse(dst, Blob_Interface::to_bytes(values).data(), sizeof(Ts))), ...);
+    this->m_pos_idx += number_of_bytes;
+    return true;
   }
 
-  template <ArithmeticOrByte T> inline bool MemoryBlob::try_read_back(T& value, std::endian endian) const noexcept
+  template <typename Tblob>
+  template <ArithmeticOrByte T> inline constexpr bool Blob_Interface<Tblob>::try_read(std::size_t const& offset, T& value, std::endian endian) const noexcept
   {
-    if (endian == std::endian::native)
-    {
-      return this->try_read_back(reinterpret_cast<std ::byte*>(&value), sizeof(value));
-    }
-    else
-    {
-      return this->try_read_back_reverse(reinterpret_cast<std ::byte*>(&value), sizeof(value));
-    }
+    if (this->m_pos_idx < (offset + sizeof(T)))
+      return false;
+    Blob_Interface::from_bytes(value, &this->get_data()[offset], endian != std::endian::native);
+    return true;
+  }
+
+  template <typename Tblob>
+  template <ArithmeticOrByte T> inline constexpr bool Blob_Interface<Tblob>::try_read_back(T& value, std::endian endian) const noexcept
+  {
+    if (this->m_pos_idx < sizeof(T))
+      return false;
+    return this->try_read(this->m_pos_idx - sizeof(T), value, endian);
+  }
+
+  template <typename Tblob>
+  template <ArithmeticOrByte T> inline constexpr bool Blob_Interface<Tblob>::try_read_front(T& value, std::endian endian) const noexcept
+  {
+    return this->try_read(0, value, endian);
   }
 
-  template <ArithmeticOrByte T> inline bool MemoryBlob::try_read_front(T& value, std::endian endian) const noexcept
+  template <typename Tblob>
+  template <ArithmeticOrByte... Ts> requires(sizeof...(Ts) > 0) inline constexpr bool Blob_Interface<Tblob>::try_read(std::size_t const& offset, std::endian endian, Ts&... values) const noexcept
   {
+    constexpr std::size_t number_of_bytes = (sizeof(Ts) + ...);
+    if (this->m_pos_idx < (offset + number_of_bytes))
+      return false;
+
+    std::byte const* src = &this->get_data()[offset];
     if (endian == std::endian::native)
-      return this->try_read_front(reinterpret_cast<std ::byte*>(&value), sizeof(value));
+      ((src += Blob_Interface::from_bytes(values, src, false)), ...);
     else
-      return this->try_read_front_reverse(reinterpret_cast<std ::byte*>(&value), sizeof(value));
+      ((src += Blob_Interface::from_bytes(values, src, true)), ...);
+    return true;
   }
 
-  template <ArithmeticOrByte T> inline bool MemoryBlob::try_remove(std::size_t const& offset) noexcept { return this->try_remove(offset, sizeof(T)); }
+  template <typename Tblob>
+  template <ArithmeticOrByte T> inline constexpr bool Blob_Interface<Tblob>::try_remove(std::size_t const& offset) noexcept
+  {
+    return this->try_remove(offset, sizeof(T));
+  }
 
-  template <ArithmeticOrByte T> inline bool MemoryBlob::try_remove_back() noexcept { return this->try_remove_back(sizeof(T)); }
+  template <typename Tblob>
+  template <ArithmeticOrByte T> inline constexpr bool Blob_Interface<Tblob>::try_remove_back() noexcept { return this->try_remove_back(sizeof(T)); }
 
-  template <ArithmeticOrByte T> inline bool MemoryBlob::try_remove_front() noexcept { return this->try_remove_front(sizeof(T)); }
+  template <typename Tblob>
+  template <ArithmeticOrByte T> inline constexpr bool Blob_Interface<Tblob>::try_remove_front() noexcept { return this->try_remove_front(sizeof(T)); }
 
-  template <ArithmeticOrByte T> inline bool MemoryBlob::try_extract(std::size_t const& offset, T& value, std::endian endian) noexcept
+  template <typename Tblob>
+  template <ArithmeticOrByte T> inline constexpr bool Blob_Interface<Tblob>::try_extract(std::size_t const& offset, T& value, std::endian endian) noexcept
   {
     return this->try_read(offset, value, endian) && this->try_remove<T>(offset);
   }
 
-  template <ArithmeticOrByte T> inline bool MemoryBlob::try_extract_back(T& value, std::endian endian) noexcept
+  template <typename Tblob>
+  template <ArithmeticOrByte T> inline constexpr bool Blob_Interface<Tblob>::try_extract_back(T& value, std::endian endian) noexcept
   {
     return this->try_read_back(value, endian) && this->try_remove_back<T>();
   }
 
-  template <ArithmeticOrByte T> inline bool MemoryBlob::try_extract_front(T& value, std::endian endian) noexcept
+  template <typename Tblob>
+  template <ArithmeticOrByte T> inline constexpr bool Blob_Interface<Tblob>::try_extract_front(T& value, std::endian endian) noexcept
   {
     return this->try_read_front(value, endian) && this->try_remove_front<T>();
   }
 
-  template <ArithmeticOrByte T> inline void MemoryBlob::overwrite(std::size_t const& offset, T const& value, std::endian endian)
+  template <typename Tblob>
+  template <ArithmeticOrByte T> inline constexpr void Blob_Interface<Tblob>::overwrite(std::size_t const& offset, T const& value, std::endian endian)
   {
     if (endian == std::endian::native)
-      return this->overwrite(offset, reinterpret_cast<std::byte const*>(&value), sizeof(T));
+      return this->overwrite(offset, Blob_Interface::to_bytes(value).data(), sizeof(T));
     else
-      return this->overwrite_reverse(offset, reinterpret_cast<std::byte const*>(&value), sizeof(T));
+      return this->overwrite_reverse(offset, Blob_Interface::to_bytes(value).data(), sizeof(T));
   }
 
-  template <ArithmeticOrByte T> inline void MemoryBlob::overwrite_back(T const& value, std::endian endian)
+  template <typename Tblob>
+  template <ArithmeticOrByte T> inline constexpr void Blob_Interface<Tblob>::overwrite_back(T const& value, std::endian endian)
   {
     if (endian == std::endian::native)
-      return this->overwrite_back(reinterpret_cast<std::byte const*>(&value), sizeof(T));
+      return this->overwrite_back(Blob_Interface::to_bytes(value).data(), sizeof(T));
     else
-      return this->overwrite_back_reverse(reinterpret_cast<std::byte const*>(&value), sizeof(T));
+      return this->overwrite_back_reverse(Blob_Interface::to_bytes(value).data(), sizeof(T));
   }
 
-  template <ArithmeticOrByte T> inline void MemoryBlob::overwrite_front(T const& value, std::endian endian)
+  template <typename Tblob>
+  template <ArithmeticOrByte T> inline constexpr void Blob_Interface<Tblob>::overwrite_front(T const& value, std::endian endian)
   {
     if (endian == std::endian::native)
-      return this->overwrite_front(reinterpret_cast<std::byte const*>(&value), sizeof(T));
+      return this->overwrite_front(Blob_Interface::to_bytes(value).data(), sizeof(T));
     else
-      return this->overwrite_front_reverse(reinterpret_cast<std::byte const*>(&value), sizeof(T));
+      return this->overwrite_front_reverse(Blob_Interface::to_bytes(value).data(), sizeof(T));
   }
 
-  template <ArithmeticOrByte T> inline void MemoryBlob::insert(std::size_t const& offset, T const& value, std::endian endian)
+  template <typename Tblob>
+  template <ArithmeticOrByte T> inline constexpr void Blob_Interface<Tblob>::insert(std::size_t const& offset, T const& value, std::endian endian)
   {
     if (!this->try_insert(offset, value, endian))
-      return MemoryBlob::handle_insert_exception();
+      return error::handle_insert_exception();
   }
 
-  template <ArithmeticOrByte T> inline void MemoryBlob::insert_back(T const& value, std::endian endian)
+  template <typename Tblob>
+  template <ArithmeticOrByte T> inline constexpr void Blob_Interface<Tblob>::insert_back(T const& value, std::endian endian)
   {
     if (!this->try_insert_back(value, endian))
-      return MemoryBlob::handle_insert_exception();
+      return error::handle_insert_exception();
   }
 
-  template <ArithmeticOrByte T> inline void MemoryBlob::insert_front(T const& value, std::endian endian)
+  template <typename Tblob>
+  template <ArithmeticOrByte T> inline constexpr void Blob_Interface<Tblob>::insert_front(T const& value, std::endian endian)
   {
     if (!this->try_insert_front(value, endian))
-      return MemoryBlob::handle_insert_exception();
+      return error::handle_insert_exception();
   }
 
-  template <ArithmeticOrByte T> inline T MemoryBlob::read(std::size_t const& offset, std::endian endian) const
+  template <typename Tblob>
+  template <ArithmeticOrByte... Ts> requires(sizeof...(Ts) > 0) inline constexpr void Blob_Interface<Tblob>::insert_back(std::endian endian, Ts const&... values)
+  {
+    if (!this->try_insert_back(endian, values...))
+      return error::handle_insert_exception();
+  }
+
+  template <typename Tblob>
+  template <ArithmeticOrByte T> inline constexpr T Blob_Interface<Tblob>::read(std::size_t const& offset, std::endian endian) const
   {
     T ret{};
     if (!this->try_read(offset, ret, endian))
-      MemoryBlob::handle_read_exception();
+      error::handle_read_exception();
 
     return ret;
   }
 
-  template <ArithmeticOrByte T> inline T MemoryBlob::read_back(std::endian endian) const
+  template <typename Tblob>
+  template <ArithmeticOrByte T> inline constexpr T Blob_Interface<Tblob>::read_back(std::endian endian) const
   {
     T ret{};
     if (!this->try_read_back(ret, endian))
-      MemoryBlob::handle_read_exception();
+      error::handle_read_exception();
 
     return ret;
   }
 
-  template <ArithmeticOrByte T> inline T MemoryBlob::read_front(std::endian endian) const
+  template <typename Tblob>
+  template <ArithmeticOrByte T> inline constexpr T Blob_Interface<Tblob>::read_front(std::endian endian) const
   {
     T ret{};
     if (!this->try_read_front(ret, endian))
-      MemoryBlob::handle_read_exception();
+      error::handle_read_exception();
 
     return ret;
   }
 
-  template <ArithmeticOrByte T> inline T MemoryBlob::extract(std::size_t const& offset, std::endian endian)
+  template <typename Tblob>
+  template <ArithmeticOrByte... Ts> requires(sizeof...(Ts) > 0) inline constexpr void Blob_Interface<Tblob>::read(std::size_t const& offset, std::endian endian, Ts&... values) const
+  {
+    if (!this->try_read(offset, endian, values...))
+      return error::handle_read_exception();
+  }
+
+  template <typename Tblob>
+  template <ArithmeticOrByte T> inline constexpr T Blob_Interface<Tblob>::extract(std::size_t const& offset, std::endian endian)
   {
     T ret = this->read<T>(offset, endian);
     this->remove(offset, sizeof(T));
     return ret;
   }
 
-  template <ArithmeticOrByte T> inline T MemoryBlob::extract_back(std::endian endian)
+  template <typename Tblob>
+  template <ArithmeticOrByte T> inline constexpr T Blob_Interface<Tblob>::extract_back(std::endian endian)
   {
     T ret = this->read_back<T>(endian);
     this->remove_back(sizeof(T));
     return ret;
   }
 
-  template <ArithmeticOrByte T> inline T MemoryBlob::extract_front(std::endian endian)
+  template <typename Tblob>
+  template <ArithmeticOrByte T> inline constexpr T Blob_Interface<Tblob>::extract_front(std::endian endian)
   {
     T ret = this->read_front<T>(endian);
     this->remove_front(sizeof(T));
     return ret;
   }
 
+  template <typename Tblob>
+  template <ArithmeticOrByte T, std::endian endian> inline constexpr void Blob_Interface<Tblob>::store(std::byte* dst, T const& value) noexcept
+  {
+    T const tmp = (endian == std::endian::native) ? value : wlib::blob::byteswap(value);
+    if (std::is_constant_evaluated())
+      Blob_Interface::byte_copy(dst, Blob_Interface::to_bytes(tmp).data(), sizeof(T));
+    else
+      std::memcpy(dst, &tmp, sizeof(T));
+  }
+
+  template <typename Tblob>
+  template <ArithmeticOrByte T, std::endian endian> inline constexpr T Blob_Interface<Tblob>::load(std::byte const* src) noexcept
+  {
+    T tmp;
+    if (std::is_constant_evaluated())
+      Blob_Interface::from_bytes(tmp, src, false);
+    else
+      std::memcpy(&tmp, src, sizeof(T));
+    return (endian == std::endian::native) ? tmp : wlib::blob::byteswap(tmp);
+  }
+
+  template <typename Tblob>
+  template <ArithmeticOrByte T> inline constexpr std::array<std::byte, sizeof(T)> Blob_Interface<Tblob>::to_bytes(T const& value) noexcept
+  {
+    return std::bit_cast<std::array<std::byte, sizeof(T)>>(value);
+  }
+
+  template <typename Tblob>
+  template <ArithmeticOrByte T> inline constexpr std::size_t Blob_Interface<Tblob>::from_bytes(T& value, std::byte const* src, bool reverse) noexcept
+  {
+    std::array<std::byte, sizeof(T)> raw;
+    if (reverse)
+      Blob_Interface::byte_copy_reverse(raw.data(), src, sizeof(T));
+    else
+      Blob_Interface::byte_copy(raw.data(), src, sizeof(T));
+    value = std::bit_cast<T>(raw);
+    return sizeof(T);
+  }
+
+  template <typename Tblob>
+  template <ArithmeticOrByte T> inline constexpr void Blob_Interface<Tblob>::bulk_store(std::byte* dst, std::span<T const> const& values, std::endian endian) noexcept
+  {
+    if (std::is_constant_evaluated())
+    {
+      for (T const& value : values)
+      {
+        if (endian == std::endian::native)
+          dst += Blob_Interface::byte_copy(dst, Blob_Interface::to_bytes(value).data(), sizeof(T));
+        else
+          dst += Blob_Interface::byte_copy_reverse(dst, Blob_Interface::to_bytes(value).data(), sizeof(T));
+      }
+    }
+    else
+    {
+      Blob_Interface::bulk_copy(dst, reinterpret_cast<std::byte const*>(values.data()), values.size(), sizeof(T), endian);
+    }
+  }
+
+  template <typename Tblob>
+  template <ArithmeticOrByte T> inline constexpr void Blob_Interface<Tblob>::bulk_load(std::span<T> const& values, std::byte const* src, std::endian endian) noexcept
+  {
+    if (std::is_constant_evaluated())
+    {
+      for (T& value : values)
+        src += Blob_Interface::from_bytes(value, src, endian != std::endian::native);
+    }
+    else
+    {
+      Blob_Interface::bulk_copy(reinterpret_cast<std::byte*>(values.data()), src, values.size(), sizeof(T), endian);
+    }
+  }
+
+  template <typename Tblob>
+  template <ArithmeticOrByte T, std::endian endian> inline constexpr bool Blob_Interface<Tblob>::try_overwrite(std::size_t const& offset, T const& value) noexcept
+  {
+    if (this->m_pos_idx < (offset + sizeof(T)))
+      return false;
+    Blob_Interface::store<T, endian>(&this->get_data()[offset], value);
+    return true;
+  }
+
+  template <typename Tblob>
+  template <ArithmeticOrByte T, std::endian endian> inline constexpr bool Blob_Interface<Tblob>::try_overwrite_back(T const& value) noexcept
+  {
+    if (this->m_pos_idx < sizeof(T))
+      return false;
+    Blob_Interface::store<T, endian>(&this->get_data()[this->m_pos_idx - sizeof(T)], value);
+    return true;
+  }
+
+  template <typename Tblob>
+  template <ArithmeticOrByte T, std::endian endian> inline constexpr bool Blob_Interface<Tblob>::try_overwrite_front(T const& value) noexcept
+  {
+    return this->try_overwrite<T, endian>(0, value);
+  }
+
+  template <typename Tblob>
+  template <ArithmeticOrByte T, std::endian endian> inline constexpr bool Blob_Interface<Tblob>::try_insert(std::size_t const& offset, T const& value) noexcept
+  {
+    if (this->m_pos_idx < offset)
+      return false;
+    if (this->get_total_number_of_bytes() < (this->m_pos_idx + sizeof(T)))
+      return false;
+
+    this->m_pos_idx += Blob_Interface::data_shift_right(this->get_data(), this->m_pos_idx, offset, sizeof(T));
+    Blob_Interface::store<T, endian>(&this->get_data()[offset], value);
+    return true;
+  }
+
+  template <typename Tblob>
+  template <ArithmeticOrByte T, std::endian endian> inline constexpr bool Blob_Interface<Tblob>::try_insert_back(T const& value) noexcept
+  {
+    if (this->get_total_number_of_bytes() < (this->m_pos_idx + sizeof(T)))
+      return false;
+
+    Blob_Interface::store<T, endian>(&this->get_data()[this->m_pos_idx], value);
+    this->m_pos_idx += sizeof(T);
+    return true;
+  }
+
+  template <typename Tblob>
+  template <ArithmeticOrByte T, std::endian endian> inline constexpr bool Blob_Interface<Tblob>::try_insert_front(T const& value) noexcept
+  {
+    return this->try_insert<T, endian>(0, value);
+  }
+
+  template <typename Tblob>
+  template <ArithmeticOrByte T, std::endian endian> inline constexpr bool Blob_Interface<Tblob>::try_read(std::size_t const& offset, T& value) const noexcept
+  {
+    if (this->m_pos_idx < (offset + sizeof(T)))
+      return false;
+    value = Blob_Interface::load<T, endian>(&this->get_data()[offset]);
+    return true;
+  }
+
+  template <typename Tblob>
+  template <ArithmeticOrByte T, std::endian endian> inline constexpr bool Blob_Interface<Tblob>::try_read_back(T& value) const noexcept
+  {
+    if (this->m_pos_idx < sizeof(T))
+      return false;
+    value = Blob_Interface::load<T, endian>(&this->get_data()[this->m_pos_idx - sizeof(T)]);
+    return true;
+  }
+
+  template <typename Tblob>
+  template <ArithmeticOrByte T, std::endian endian> inline constexpr bool Blob_Interface<Tblob>::try_read_front(T& value) const noexcept
+  {
+    return this->try_read<T, endian>(0, value);
+  }
+
+  template <typename Tblob>
+  template <ArithmeticOrByte T, std::endian endian> inline constexpr bool Blob_Interface<Tblob>::try_extract(std::size_t const& offset, T& value) noexcept
+  {
+    return this->try_read<T, endian>(offset, value) && this->try_remove<T>(offset);
+  }
+
+  template <typename Tblob>
+  template <ArithmeticOrByte T, std::endian endian> inline constexpr bool Blob_Interface<Tblob>::try_extract_back(T& value) noexcept
+  {
+    if (!this->try_read_back<T, endian>(value))
+      return false;
+    this->m_pos_idx -= sizeof(T);
+    return true;
+  }
+
+  template <typename Tblob>
+  template <ArithmeticOrByte T, std::endian endian> inline constexpr bool Blob_Interface<Tblob>::try_extract_front(T& value) noexcept
+  {
+    return this->try_read_front<T, endian>(value) && this->try_remove_front<T>();
+  }
+
+  template <typename Tblob>
+  template <ArithmeticOrByte T, std::endian endian> inline constexpr void Blob_Interface<Tblob>::overwrite(std::size_t const& offset, T const& value)
+  {
+    if (!this->try_overwrite<T, endian>(offset, value))
+      return error::handle_overwrite_exception();
+  }
+
+  template <typename Tblob>
+  template <ArithmeticOrByte T, std::endian endian> inline constexpr void Blob_Interface<Tblob>::overwrite_back(T const& value)
+  {
+    if (!this->try_overwrite_back<T, endian>(value))
+      return error::handle_overwrite_exception();
+  }
+
+  template <typename Tblob>
+  template <ArithmeticOrByte T, std::endian endian> inline constexpr void Blob_Interface<Tblob>::overwrite_front(T const& value)
+  {
+    if (!this->try_overwrite_front<T, endian>(value))
+      return error::handle_overwrite_exception();
+  }
+
+  template <typename Tblob>
+  template <ArithmeticOrByte T, std::endian endian> inline constexpr void Blob_Interface<Tblob>::insert(std::size_t const& offset, T const& value)
+  {
+    if (!this->try_insert<T, endian>(offset, value))
+      return error::handle_insert_exception();
+  }
+
+  template <typename Tblob>
+  template <ArithmeticOrByte T, std::endian endian> inline constexpr void Blob_Interface<Tblob>::insert_back(T const& value)
+  {
+    if (!this->try_insert_back<T, endian>(value))
+      return error::handle_insert_exception();
+  }
+
+  template <typename Tblob>
+  template <ArithmeticOrByte T, std::endian endian> inline constexpr void Blob_Interface<Tblob>::insert_front(T const& value)
+  {
+    if (!this->try_insert_front<T, endian>(value))
+      return error::handle_insert_exception();
+  }
+
+  template <typename Tblob>
+  template <ArithmeticOrByte T, std::endian endian> inline constexpr T Blob_Interface<Tblob>::read(std::size_t const& offset) const
+  {
+    T ret{};
+    if (!this->try_read<T, endian>(offset, ret))
+      error::handle_read_exception();
+
+    return ret;
+  }
+
+  template <typename Tblob>
+  template <ArithmeticOrByte T, std::endian endian> inline constexpr T Blob_Interface<Tblob>::read_back() const
+  {
+    T ret{};
+    if (!this->try_read_back<T, endian>(ret))
+      error::handle_read_exception();
+
+    return ret;
+  }
+
+  template <typename Tblob>
+  template <ArithmeticOrByte T, std::endian endian> inline constexpr T Blob_Interface<Tblob>::read_front() const
+  {
+    T ret{};
+    if (!this->try_read_front<T, endian>(ret))
+      error::handle_read_exception();
+
+    return ret;
+  }
+
+  template <typename Tblob>
+  template <ArithmeticOrByte T, std::endian endian> inline constexpr T Blob_Interface<Tblob>::extract(std::size_t const& offset)
+  {
+    T ret = this->read<T, endian>(offset);
+    this->remove(offset, sizeof(T));
+    return ret;
+  }
+
+  template <typename Tblob>
+  template <ArithmeticOrByte T, std::endian endian> inline constexpr T Blob_Interface<Tblob>::extract_back()
+  {
+    T ret = this->read_back<T, endian>();
+    this->remove_back(sizeof(T));
+    return ret;
+  }
+
+  template <typename Tblob>
+  template <ArithmeticOrByte T, std::endian endian> inline constexpr T Blob_Interface<Tblob>::extract_front()
+  {
+    T ret = this->read_front<T, endian>();
+    this->remove_front(sizeof(T));
+    return ret;
+  }
+
+  template <typename Tblob>
+  template <ArithmeticOrByte T> inline constexpr bool Blob_Interface<Tblob>::try_overwrite(std::size_t const& offset, std::span<T const> const& values, std::endian endian) noexcept
+  {
+    if (this->m_pos_idx < (offset + values.size_bytes()))
+      return false;
+    Blob_Interface::bulk_store(&this->get_data()[offset], values, endian);
+    return true;
+  }
+
+  template <typename Tblob>
+  template <ArithmeticOrByte T> inline constexpr bool Blob_Interface<Tblob>::try_insert_back(std::span<T const> const& values, std::endian endian) noexcept
+  {
+    if (this->get_number_of_free_bytes() < values.size_bytes())
+      return false;
+    Blob_Interface::bulk_store(&this->get_data()[this->m_pos_idx], values, endian);
+    this->m_pos_idx += values.size_bytes();
+    return true;
+  }
+
+  template <typename Tblob>
+  template <ArithmeticOrByte T> inline constexpr bool Blob_Interface<Tblob>::try_read(std::size_t const& offset, std::span<T> const& values, std::endian endian) const noexcept
+  {
+    if (this->m_pos_idx < (offset + values.size_bytes()))
+      return false;
+    Blob_Interface::bulk_load(values, &this->get_data()[offset], endian);
+    return true;
+  }
+
+  template <typename Tblob>
+  template <ArithmeticOrByte T> inline constexpr void Blob_Interface<Tblob>::overwrite(std::size_t const& offset, std::span<T const> const& values, std::endian endian)
+  {
+    if (!this->try_overwrite(offset, values, endian))
+      return error::handle_overwrite_exception();
+  }
+
+  template <typename Tblob>
+  template <ArithmeticOrByte T> inline constexpr void Blob_Interface<Tblob>::insert_back(std::span<T const> const& values, std::endian endian)
+  {
+    if (!this->try_insert_back(values, endian))
+      return error::handle_insert_exception();
+  }
+
+  template <typename Tblob>
+  template <ArithmeticOrByte T> inline constexpr void Blob_Interface<Tblob>::read(std::size_t const& offset, std::span<T> const& values, std::endian endian) const
+  {
+    if (!this->try_read(offset, values, endian))
+      return error::handle_read_exception();
+  }
+
   inline constexpr MemoryBlob::MemoryBlob(std::byte* begin, std::byte* end) noexcept
       : MemoryBlob(begin, end - begin, 0)
   {
@@ -418,27 +1052,111 @@ namespace wlib::blob
   {
   }
   inline constexpr MemoryBlob::MemoryBlob(std::byte* begin, std::size_t const& size, std::size_t const& position_idx) noexcept
-      : m_data(begin)
+      : Blob_Interface<MemoryBlob>(position_idx)
+      , m_data(begin)
       , m_size(size)
-      , m_pos_idx(position_idx)
   {
   }
   inline constexpr MemoryBlob::MemoryBlob(std::span<std::byte>& data, std::size_t const& position_idx) noexcept
       : MemoryBlob(data.data(), data.size_bytes(), position_idx)
   {
   }
-  inline constexpr std::size_t                              MemoryBlob::get_total_number_of_bytes() const noexcept { return this->m_size; }
-  inline constexpr std::size_t                              MemoryBlob::get_number_of_free_bytes() const noexcept { return this->m_size - this->m_pos_idx; }
-  inline constexpr std::size_t                              MemoryBlob::get_number_of_used_bytes() const noexcept { return this->m_pos_idx; }
-  [[nodiscard]] inline constexpr std::span<std::byte const> MemoryBlob::get_blob() const noexcept
+  template <typename Tblob>
+  inline constexpr std::size_t Blob_Interface<Tblob>::get_total_number_of_bytes() const noexcept { return static_cast<Tblob const*>(this)->m_size; }
+  template <typename Tblob>
+  inline constexpr std::size_t Blob_Interface<Tblob>::get_number_of_free_bytes() const noexcept { return this->get_total_number_of_bytes() - this->m_pos_idx; }
+  template <typename Tblob>
+  inline constexpr std::size_t Blob_Interface<Tblob>::get_number_of_used_bytes() const noexcept { return this->m_pos_idx; }
+  template <typename Tblob>
+  [[nodiscard]] inline constexpr std::span<std::byte const> Blob_Interface<Tblob>::get_blob() const noexcept
+  {
+    return std::span<std::byte const>(this->get_data(), this->m_pos_idx);
+  }
+  template <typename Tblob>
+  [[nodiscard]] inline constexpr std::span<std::byte> Blob_Interface<Tblob>::get_blob() noexcept
+  {
+    return std::span<std::byte>(this->get_data(), this->m_pos_idx);
+  }
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::clear() noexcept { this->m_pos_idx = 0; }
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_subblob(std::size_t const& offset, std::size_t const& number_of_bytes, BlobView& view) noexcept
+  {
+    if (this->m_pos_idx < (offset + number_of_bytes))
+      return false;
+    view = BlobView(&this->get_data()[offset], number_of_bytes);
+    return true;
+  }
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_subblob(std::size_t const& offset, std::size_t const& number_of_bytes, ConstBlobView& view) const noexcept
+  {
+    if (this->m_pos_idx < (offset + number_of_bytes))
+      return false;
+    view = ConstBlobView(&this->get_data()[offset], number_of_bytes);
+    return true;
+  }
+  template <typename Tblob>
+  [[nodiscard]] inline constexpr BlobView Blob_Interface<Tblob>::subblob(std::size_t const& offset, std::size_t const& number_of_bytes)
+  {
+    BlobView view;
+    if (!this->try_subblob(offset, number_of_bytes, view))
+      error::handle_read_exception();
+    return view;
+  }
+  template <typename Tblob>
+  [[nodiscard]] inline constexpr ConstBlobView Blob_Interface<Tblob>::subblob(std::size_t const& offset, std::size_t const& number_of_bytes) const
   {
-    return std::span<std::byte const>(this->m_data, this->m_pos_idx);
+    ConstBlobView view;
+    if (!this->try_subblob(offset, number_of_bytes, view))
+      error::handle_read_exception();
+    return view;
   }
-  [[nodiscard]] inline constexpr std::span<std::byte> MemoryBlob::get_blob() noexcept { return std::span<std::byte>(this->m_data, this->m_pos_idx); }
-  inline constexpr void                               MemoryBlob::clear() noexcept { this->m_pos_idx = 0; }
-  inline constexpr bool                               MemoryBlob::try_adjust_position(std::ptrdiff_t const& offset) noexcept
+  template <typename Tblob>
+  template <ArithmeticOrByte T> inline bool Blob_Interface<Tblob>::try_as_span(std::size_t const& offset, std::size_t const& count, std::span<T>& view) noexcept
   {
-    if ((offset > 0) && (this->m_pos_idx + offset) > this->m_size)
+    if ((this->m_pos_idx < offset) || (((this->m_pos_idx - offset) / sizeof(T)) < count))
+      return false;
+    std::byte* const data = &this->get_data()[offset];
+    if ((reinterpret_cast<std::uintptr_t>(data) % alignof(T)) != 0)
+      return false;
+    view = std::span<T>(reinterpret_cast<T*>(data), count);
+    return true;
+  }
+  template <typename Tblob>
+  template <ArithmeticOrByte T>
+  inline bool Blob_Interface<Tblob>::try_as_span(std::size_t const& offset, std::size_t const& count, std::span<T const>& view) const noexcept
+  {
+    if ((this->m_pos_idx < offset) || (((this->m_pos_idx - offset) / sizeof(T)) < count))
+      return false;
+    std::byte const* const data = &this->get_data()[offset];
+    if ((reinterpret_cast<std::uintptr_t>(data) % alignof(T)) != 0)
+      return false;
+    view = std::span<T const>(reinterpret_cast<T const*>(data), count);
+    return true;
+  }
+  template <typename Tblob>
+  template <ArithmeticOrByte T> [[nodiscard]] inline std::span<T const> Blob_Interface<Tblob>::as_span(std::size_t const& offset, std::size_t const& count) const
+  {
+    std::span<T const> view;
+    if (!this->try_as_span(offset, count, view))
+      error::handle_read_exception();
+    return view;
+  }
+  template <typename Tblob>
+  template <ArithmeticOrByte T>
+  [[nodiscard]] inline std::span<T const> Blob_Interface<Tblob>::as_span(std::size_t const& offset, std::size_t const& count, std::span<T> const& buffer) const
+  {
+    std::span<T const> view;
+    if (this->try_as_span(offset, count, view))
+      return view;
+    if ((buffer.size() < count) || !this->try_read(offset, buffer.first(count)))
+      error::handle_read_exception();
+    return buffer.first(count);
+  }
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_adjust_position(std::ptrdiff_t const& offset) noexcept
+  {
+    if ((offset > 0) && (this->m_pos_idx + offset) > this->get_total_number_of_bytes())
       return false;
     if ((offset < 0) && (this->m_pos_idx < -offset))
       return false;
@@ -446,422 +1164,564 @@ namespace wlib::blob
     this->m_pos_idx += offset;
     return true;
   }
-  inline constexpr bool MemoryBlob::try_set_position(std::size_t const& position) noexcept
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_set_position(std::size_t const& position) noexcept
   {
-    if (this->m_size < position)
+    if (this->get_total_number_of_bytes() < position)
       return false;
     this->m_pos_idx = position;
     return true;
   }
-  inline bool MemoryBlob::try_overwrite(std::size_t const& offset, std::byte const* begin, std::size_t const& number_of_bytes) noexcept
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_overwrite(std::size_t const& offset, std::byte const* begin, std::size_t const& number_of_bytes) noexcept
   {
     std::size_t const end_idx = offset + number_of_bytes;
     if (this->m_pos_idx < end_idx)
       return false;
-    MemoryBlob::byte_copy(&this->m_data[offset], begin, number_of_bytes);
+    Blob_Interface::byte_copy(&this->get_data()[offset], begin, number_of_bytes);
     return true;
   }
-  inline bool MemoryBlob::try_overwrite_reverse(std::size_t const& offset, std::byte const* begin, std::size_t const& number_of_bytes) noexcept
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_overwrite_reverse(std::size_t const& offset, std::byte const* begin, std::size_t const& number_of_bytes) noexcept
   {
     std::size_t const end_idx = offset + number_of_bytes;
     if (this->m_pos_idx < end_idx)
       return false;
-    MemoryBlob::byte_copy_reverse(&this->m_data[offset], begin, number_of_bytes);
+    Blob_Interface::byte_copy_reverse(&this->get_data()[offset], begin, number_of_bytes);
     return true;
   }
-  inline bool MemoryBlob::try_overwrite(std::size_t const& offset, std::byte const& byte) noexcept { return this->try_overwrite(offset, &byte, 1); }
-  inline bool MemoryBlob::try_overwrite(std::size_t const& offset, std::byte const* begin, std::byte const* end) noexcept
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_overwrite(std::size_t const& offset, std::byte const& byte) noexcept { return this->try_overwrite(offset, &byte, 1); }
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_overwrite(std::size_t const& offset, std::byte const* begin, std::byte const* end) noexcept
   {
     return this->try_overwrite(offset, begin, end - begin);
   }
-  inline bool MemoryBlob::try_overwrite(std::size_t const& offset, std::span<std::byte> const& data) noexcept
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_overwrite(std::size_t const& offset, std::span<std::byte> const& data) noexcept
   {
     return this->try_overwrite(offset, data.data(), data.size_bytes());
   }
-  inline bool MemoryBlob::try_overwrite_back(std::byte const& byte) noexcept { return this->try_overwrite(this->m_pos_idx - 1, byte); }
-  inline bool MemoryBlob::try_overwrite_back(std::byte const* begin, std::byte const* end) noexcept
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_overwrite_back(std::byte const& byte) noexcept { return this->try_overwrite(this->m_pos_idx - 1, byte); }
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_overwrite_back(std::byte const* begin, std::byte const* end) noexcept
   {
     return this->try_overwrite(this->m_pos_idx - (end - begin), begin, end);
   }
-  inline bool MemoryBlob::try_overwrite_back(std::byte const* begin, std::size_t const& number_of_bytes) noexcept
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_overwrite_back(std::byte const* begin, std::size_t const& number_of_bytes) noexcept
   {
     if (this->m_pos_idx < number_of_bytes)
       return false;
     return this->try_overwrite(this->m_pos_idx - number_of_bytes, begin, number_of_bytes);
   }
-  inline bool MemoryBlob::try_overwrite_back(std::span<std::byte> const& data) noexcept
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_overwrite_back(std::span<std::byte> const& data) noexcept
   {
     return this->try_overwrite(this->m_pos_idx - data.size_bytes(), data);
   }
-  inline bool MemoryBlob::try_overwrite_front(std::byte const& byte) noexcept { return this->try_overwrite(0, byte); }
-  inline bool MemoryBlob::try_overwrite_front(std::byte const* begin, std::byte const* end) noexcept { return this->try_overwrite(0, begin, end); }
-  inline bool MemoryBlob::try_overwrite_front(std::byte const* begin, std::size_t const& number_of_bytes) noexcept
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_overwrite_front(std::byte const& byte) noexcept { return this->try_overwrite(0, byte); }
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_overwrite_front(std::byte const* begin, std::byte const* end) noexcept { return this->try_overwrite(0, begin, end); }
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_overwrite_front(std::byte const* begin, std::size_t const& number_of_bytes) noexcept
   {
     return this->try_overwrite(0, begin, number_of_bytes);
   }
-  inline bool MemoryBlob::try_overwrite_front(std::span<std::byte> const& data) noexcept { return this->try_overwrite(0, data); }
-  inline bool MemoryBlob::try_overwrite_reverse(std::size_t const& offset, std::byte const& byte) noexcept
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_overwrite_front(std::span<std::byte> const& data) noexcept { return this->try_overwrite(0, data); }
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_overwrite_reverse(std::size_t const& offset, std::byte const& byte) noexcept
   {
     return this->try_overwrite_reverse(offset, &byte, 1);
   }
-  inline bool MemoryBlob::try_overwrite_reverse(std::size_t const& offset, std::byte const* begin, std::byte const* end) noexcept
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_overwrite_reverse(std::size_t const& offset, std::byte const* begin, std::byte const* end) noexcept
   {
     return this->try_overwrite_reverse(offset, begin, end - begin);
   }
-  inline bool MemoryBlob::try_overwrite_reverse(std::size_t const& offset, std::span<std::byte> const& data) noexcept
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_overwrite_reverse(std::size_t const& offset, std::span<std::byte> const& data) noexcept
   {
     return this->try_overwrite_reverse(offset, data.data(), data.size_bytes());
   }
-  inline bool MemoryBlob::try_overwrite_back_reverse(std::byte const& byte) noexcept { return this->try_overwrite_reverse(this->m_pos_idx - 1, &byte, 1); }
-  inline bool MemoryBlob::try_overwrite_back_reverse(std::byte const* begin, std::byte const* end) noexcept
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_overwrite_back_reverse(std::byte const& byte) noexcept
+  {
+    return this->try_overwrite_reverse(this->m_pos_idx - 1, &byte, 1);
+  }
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_overwrite_back_reverse(std::byte const* begin, std::byte const* end) noexcept
   {
     return this->try_overwrite_reverse(this->m_pos_idx - (end - begin), begin, end);
   }
-  inline bool MemoryBlob::try_overwrite_back_reverse(std::byte const* begin, std::size_t const& number_of_bytes) noexcept
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_overwrite_back_reverse(std::byte const* begin, std::size_t const& number_of_bytes) noexcept
   {
     if (this->m_pos_idx < number_of_bytes)
       return false;
     return this->try_overwrite_reverse(this->m_pos_idx - number_of_bytes, begin, number_of_bytes);
   }
-  inline bool MemoryBlob::try_overwrite_back_reverse(std::span<std::byte> const& data) noexcept
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_overwrite_back_reverse(std::span<std::byte> const& data) noexcept
   {
     return this->try_overwrite_reverse(this->m_pos_idx - data.size_bytes(), data);
   }
-  inline bool MemoryBlob::try_overwrite_front_reverse(std::byte const& byte) noexcept { return this->try_overwrite_reverse(0, byte); }
-  inline bool MemoryBlob::try_overwrite_front_reverse(std::byte const* begin, std::byte const* end) noexcept
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_overwrite_front_reverse(std::byte const& byte) noexcept { return this->try_overwrite_reverse(0, byte); }
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_overwrite_front_reverse(std::byte const* begin, std::byte const* end) noexcept
   {
     return this->try_overwrite_reverse(0, begin, end);
   }
-  inline bool MemoryBlob::try_overwrite_front_reverse(std::byte const* begin, std::size_t const& number_of_bytes) noexcept
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_overwrite_front_reverse(std::byte const* begin, std::size_t const& number_of_bytes) noexcept
   {
     return this->try_overwrite_reverse(0, begin, number_of_bytes);
   }
-  inline bool MemoryBlob::try_overwrite_front_reverse(std::span<std::byte> const& data) noexcept { return this->try_overwrite_reverse(0, data); }
-  inline bool MemoryBlob::try_insert(std::size_t const& offset, std::byte const* begin, std::size_t const& number_of_bytes) noexcept
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_overwrite_front_reverse(std::span<std::byte> const& data) noexcept { return this->try_overwrite_reverse(0, data); }
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_insert(std::size_t const& offset, std::byte const* begin, std::size_t const& number_of_bytes) noexcept
   {
     if (this->m_pos_idx < offset)
       return false;
 
     std::size_t const end_idx = this->m_pos_idx + number_of_bytes;
-    if (this->m_size < end_idx)
+    if (this->get_total_number_of_bytes() < end_idx)
       return false;
 
-    std::size_t const tmp = MemoryBlob::data_shift_right(this->m_data, this->m_pos_idx, offset, number_of_bytes);
-    MemoryBlob::byte_copy(&this->m_data[offset], begin, number_of_bytes);
+    std::size_t const tmp = Blob_Interface::data_shift_right(this->get_data(), this->m_pos_idx, offset, number_of_bytes);
+    Blob_Interface::byte_copy(&this->get_data()[offset], begin, number_of_bytes);
     this->m_pos_idx += tmp;
     return true;
   }
-  inline bool MemoryBlob::try_insert_reverse(std::size_t const& offset, std::byte const* begin, std::size_t const& number_of_bytes) noexcept
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_insert_reverse(std::size_t const& offset, std::byte const* begin, std::size_t const& number_of_bytes) noexcept
   {
     if (this->m_pos_idx < offset)
       return false;
 
     std::size_t const end_idx = this->m_pos_idx + number_of_bytes;
-    if (this->m_size < end_idx)
+    if (this->get_total_number_of_bytes() < end_idx)
       return false;
 
-    std::size_t const tmp = MemoryBlob::data_shift_right(this->m_data, this->m_pos_idx, offset, number_of_bytes);
-    MemoryBlob::byte_copy_reverse(&this->m_data[offset], begin, number_of_bytes);
+    std::size_t const tmp = Blob_Interface::data_shift_right(this->get_data(), this->m_pos_idx, offset, number_of_bytes);
+    Blob_Interface::byte_copy_reverse(&this->get_data()[offset], begin, number_of_bytes);
     this->m_pos_idx += tmp;
     return true;
   }
-  inline bool MemoryBlob::try_insert(std::size_t const& offset, std::byte const& byte) noexcept { return this->try_insert(offset, &byte, 1); }
-  inline bool MemoryBlob::try_insert(std::size_t const& offset, std::byte const* begin, std::byte const* end) noexcept
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_insert(std::size_t const& offset, std::byte const& byte) noexcept { return this->try_insert(offset, &byte, 1); }
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_insert(std::size_t const& offset, std::byte const* begin, std::byte const* end) noexcept
   {
     return this->try_insert(offset, begin, end - begin);
   }
-  inline bool MemoryBlob::try_insert(std::size_t const& offset, std::span<std::byte> const& data) noexcept
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_insert(std::size_t const& offset, std::span<std::byte> const& data) noexcept
   {
     return this->try_insert(offset, data.data(), data.size_bytes());
   }
-  inline bool MemoryBlob::try_insert_back(std::byte const& byte) noexcept { return this->try_insert_back(&byte, 1); }
-  inline bool MemoryBlob::try_insert_back(std::byte const* begin, std::byte const* end) noexcept { return this->try_insert_back(begin, end - begin); }
-  inline bool MemoryBlob::try_insert_back(std::byte const* begin, std::size_t const& number_of_bytes) noexcept
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_insert_back(std::byte const& byte) noexcept { return this->try_insert_back(&byte, 1); }
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_insert_back(std::byte const* begin, std::byte const* end) noexcept
+  {
+    return this->try_insert_back(begin, end - begin);
+  }
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_insert_back(std::byte const* begin, std::size_t const& number_of_bytes) noexcept
   {
     return this->try_insert(this->m_pos_idx, begin, number_of_bytes);
   }
-  inline bool MemoryBlob::try_insert_back(std::span<std::byte> const& data) noexcept { return this->try_insert_back(data.data(), data.size_bytes()); }
-  inline bool MemoryBlob::try_insert_front(std::byte const& byte) noexcept { return this->try_insert_front(&byte, 1); }
-  inline bool MemoryBlob::try_insert_front(std::byte const* begin, std::byte const* end) noexcept { return this->try_insert_front(begin, end - begin); }
-  inline bool MemoryBlob::try_insert_front(std::byte const* begin, std::size_t const& number_of_bytes) noexcept
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_insert_back(std::span<std::byte> const& data) noexcept
+  {
+    return this->try_insert_back(data.data(), data.size_bytes());
+  }
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_insert_front(std::byte const& byte) noexcept { return this->try_insert_front(&byte, 1); }
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_insert_front(std::byte const* begin, std::byte const* end) noexcept
+  {
+    return this->try_insert_front(begin, end - begin);
+  }
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_insert_front(std::byte const* begin, std::size_t const& number_of_bytes) noexcept
   {
     return this->try_insert(0, begin, number_of_bytes);
   }
-  inline bool MemoryBlob::try_insert_front(std::span<std::byte> const& data) noexcept { return this->try_insert_front(data.data(), data.size_bytes()); }
-  inline bool MemoryBlob::try_insert_reverse(std::size_t const& offset, std::byte const& byte) noexcept { return this->try_insert_reverse(offset, &byte, 1); }
-  inline bool MemoryBlob::try_insert_reverse(std::size_t const& offset, std::byte const* begin, std::byte const* end) noexcept
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_insert_front(std::span<std::byte> const& data) noexcept
+  {
+    return this->try_insert_front(data.data(), data.size_bytes());
+  }
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_insert_reverse(std::size_t const& offset, std::byte const& byte) noexcept
+  {
+    return this->try_insert_reverse(offset, &byte, 1);
+  }
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_insert_reverse(std::size_t const& offset, std::byte const* begin, std::byte const* end) noexcept
   {
     return this->try_insert_reverse(offset, begin, end - begin);
   }
-  inline bool MemoryBlob::try_insert_reverse(std::size_t const& offset, std::span<std::byte> const& data) noexcept
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_insert_reverse(std::size_t const& offset, std::span<std::byte> const& data) noexcept
   {
     return this->try_insert_reverse(offset, data.data(), data.size_bytes());
   }
-  inline bool MemoryBlob::try_insert_back_reverse(std::byte const& byte) noexcept { return this->try_insert_back_reverse(&byte, 1); }
-  inline bool MemoryBlob::try_insert_back_reverse(std::byte const* begin, std::byte const* end) noexcept
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_insert_back_reverse(std::byte const& byte) noexcept { return this->try_insert_back_reverse(&byte, 1); }
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_insert_back_reverse(std::byte const* begin, std::byte const* end) noexcept
   {
     return this->try_insert_back_reverse(begin, end - begin);
   }
-  inline bool MemoryBlob::try_insert_back_reverse(std::byte const* begin, std::size_t const& number_of_bytes) noexcept
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_insert_back_reverse(std::byte const* begin, std::size_t const& number_of_bytes) noexcept
   {
     return this->try_insert_reverse(this->m_pos_idx, begin, number_of_bytes);
   }
-  inline bool MemoryBlob::try_insert_back_reverse(std::span<std::byte> const& data) noexcept
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_insert_back_reverse(std::span<std::byte> const& data) noexcept
   {
     return this->try_insert_back_reverse(data.data(), data.size_bytes());
   }
-  inline bool MemoryBlob::try_insert_front_reverse(std::byte const& byte) noexcept { return this->try_insert_front_reverse(&byte, 1); }
-  inline bool MemoryBlob::try_insert_front_reverse(std::byte const* begin, std::byte const* end) noexcept
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_insert_front_reverse(std::byte const& byte) noexcept { return this->try_insert_front_reverse(&byte, 1); }
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_insert_front_reverse(std::byte const* begin, std::byte const* end) noexcept
   {
     return this->try_insert_front_reverse(begin, end - begin);
   }
-  inline bool MemoryBlob::try_insert_front_reverse(std::byte const* begin, std::size_t const& number_of_bytes) noexcept
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_insert_front_reverse(std::byte const* begin, std::size_t const& number_of_bytes) noexcept
   {
     return this->try_insert_reverse(0, begin, number_of_bytes);
   }
-  inline bool MemoryBlob::try_insert_front_reverse(std::span<std::byte> const& data) noexcept
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_insert_front_reverse(std::span<std::byte> const& data) noexcept
   {
     return this->try_insert_front_reverse(data.data(), data.size_bytes());
   }
-  inline constexpr bool MemoryBlob::try_read(std::size_t const& offset, std::byte* ptr, std::size_t const& number_of_bytes) const noexcept
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_read(std::size_t const& offset, std::byte* ptr, std::size_t const& number_of_bytes) const noexcept
   {
     if (this->m_pos_idx < (offset + number_of_bytes))
       return false;
 
-    MemoryBlob::byte_copy(ptr, &this->m_data[offset], number_of_bytes);
+    Blob_Interface::byte_copy(ptr, &this->get_data()[offset], number_of_bytes);
     return true;
   }
-  inline constexpr bool MemoryBlob::try_read_reverse(std::size_t const& offset, std::byte* ptr, std::size_t const& number_of_bytes) const noexcept
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_read_reverse(std::size_t const& offset, std::byte* ptr, std::size_t const& number_of_bytes) const noexcept
   {
     if (this->m_pos_idx < (offset + number_of_bytes))
       return false;
 
-    MemoryBlob::byte_copy_reverse(ptr, &this->m_data[offset], number_of_bytes);
+    Blob_Interface::byte_copy_reverse(ptr, &this->get_data()[offset], number_of_bytes);
     return true;
   }
-  inline constexpr bool MemoryBlob::try_read_back(std::byte* ptr, std::size_t const& number_of_bytes) const noexcept
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_read_back(std::byte* ptr, std::size_t const& number_of_bytes) const noexcept
   {
     if (this->m_pos_idx < number_of_bytes)
       return false;
     return this->try_read(this->m_pos_idx - number_of_bytes, ptr, number_of_bytes);
   }
-  inline constexpr bool MemoryBlob::try_read_front(std::byte* ptr, std::size_t const& number_of_bytes) const noexcept
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_read_front(std::byte* ptr, std::size_t const& number_of_bytes) const noexcept
   {
     return this->try_read(0, ptr, number_of_bytes);
   }
-  inline constexpr bool MemoryBlob::try_read_back_reverse(std::byte* ptr, std::size_t const& number_of_bytes) const noexcept
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_read_back_reverse(std::byte* ptr, std::size_t const& number_of_bytes) const noexcept
   {
     if (this->m_pos_idx < number_of_bytes)
       return false;
     return this->try_read_reverse(this->m_pos_idx - number_of_bytes, ptr, number_of_bytes);
   }
-  inline constexpr bool MemoryBlob::try_read_front_reverse(std::byte* ptr, std::size_t const& number_of_bytes) const noexcept
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_read_front_reverse(std::byte* ptr, std::size_t const& number_of_bytes) const noexcept
   {
     return this->try_read_reverse(0, ptr, number_of_bytes);
   }
-  inline bool MemoryBlob::try_remove(std::size_t const& offset, std::size_t const& number_of_bytes) noexcept
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_remove(std::size_t const& offset, std::size_t const& number_of_bytes) noexcept
   {
     if (this->m_pos_idx < (offset + number_of_bytes))
       return false;
 
-    this->m_pos_idx -= this->data_shift_left(this->m_data, this->m_pos_idx, offset, number_of_bytes);
+    this->m_pos_idx -= this->data_shift_left(this->get_data(), this->m_pos_idx, offset, number_of_bytes);
     return true;
   }
-  inline bool MemoryBlob::try_remove_back(std::size_t const& number_of_bytes) noexcept
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_remove_back(std::size_t const& number_of_bytes) noexcept
   {
     return this->try_remove(this->m_pos_idx - number_of_bytes, number_of_bytes);
   }
-  inline bool MemoryBlob::try_remove_front(std::size_t const& number_of_bytes) noexcept { return this->try_remove(0, number_of_bytes); }
-  inline void MemoryBlob::adjust_position(std::ptrdiff_t const& offset)
+  template <typename Tblob>
+  inline constexpr bool Blob_Interface<Tblob>::try_remove_front(std::size_t const& number_of_bytes) noexcept { return this->try_remove(0, number_of_bytes); }
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::adjust_position(std::ptrdiff_t const& offset)
   {
     if (!this->try_adjust_position(offset))
-      return MemoryBlob::handle_position_exception();
+      return error::handle_position_exception();
   }
-  inline void MemoryBlob::set_position(std::size_t const& position)
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::set_position(std::size_t const& position)
   {
     if (!this->try_set_position(position))
-      return MemoryBlob::handle_position_exception();
+      return error::handle_position_exception();
   }
-  inline void MemoryBlob::overwrite(std::size_t const& offset, std::byte const* begin, std::size_t const& number_of_bytes)
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::overwrite(std::size_t const& offset, std::byte const* begin, std::size_t const& number_of_bytes)
   {
     if (!this->try_overwrite(offset, begin, number_of_bytes))
-      return MemoryBlob::handle_overwrite_exception();
+      return error::handle_overwrite_exception();
   }
-  inline void MemoryBlob::overwrite_reverse(std::size_t const& offset, std::byte const* begin, std::size_t const& number_of_bytes)
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::overwrite_reverse(std::size_t const& offset, std::byte const* begin, std::size_t const& number_of_bytes)
   {
     if (!this->try_overwrite_reverse(offset, begin, number_of_bytes))
-      return MemoryBlob::handle_overwrite_exception();
+      return error::handle_overwrite_exception();
   }
-  inline void MemoryBlob::overwrite(std::size_t const& offset, std::byte const& byte)
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::overwrite(std::size_t const& offset, std::byte const& byte)
   {
     if (!this->try_overwrite(offset, byte))
-      return MemoryBlob::handle_overwrite_exception();
+      return error::handle_overwrite_exception();
   }
-  inline void MemoryBlob::overwrite(std::size_t const& offset, std::byte const* begin, std::byte const* end)
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::overwrite(std::size_t const& offset, std::byte const* begin, std::byte const* end)
   {
     if (!this->try_overwrite(offset, begin, end))
-      return MemoryBlob::handle_overwrite_exception();
+      return error::handle_overwrite_exception();
   }
-  inline void MemoryBlob::overwrite(std::size_t const& offset, std::span<std::byte> const& data)
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::overwrite(std::size_t const& offset, std::span<std::byte> const& data)
   {
     if (!this->try_overwrite(offset, data))
-      return MemoryBlob::handle_overwrite_exception();
+      return error::handle_overwrite_exception();
   }
-  inline void MemoryBlob::overwrite_back(std::byte const& byte)
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::overwrite_back(std::byte const& byte)
   {
     if (!this->try_overwrite_back(byte))
-      return MemoryBlob::handle_overwrite_exception();
+      return error::handle_overwrite_exception();
   }
-  inline void MemoryBlob::overwrite_back(std::byte const* begin, std::byte const* end)
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::overwrite_back(std::byte const* begin, std::byte const* end)
   {
     if (!this->try_overwrite_back(begin, end))
-      return MemoryBlob::handle_overwrite_exception();
+      return error::handle_overwrite_exception();
   }
-  inline void MemoryBlob::overwrite_back(std::byte const* begin, std::size_t const& number_of_bytes)
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::overwrite_back(std::byte const* begin, std::size_t const& number_of_bytes)
   {
     if (!this->try_overwrite_back(begin, number_of_bytes))
-      return MemoryBlob::handle_overwrite_exception();
+      return error::handle_overwrite_exception();
   }
-  inline void MemoryBlob::overwrite_back(std::span<std::byte> const& data)
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::overwrite_back(std::span<std::byte> const& data)
   {
     if (!this->try_overwrite_back(data))
-      return MemoryBlob::handle_overwrite_exception();
+      return error::handle_overwrite_exception();
   }
-  inline void MemoryBlob::overwrite_front(std::byte const& byte)
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::overwrite_front(std::byte const& byte)
   {
     if (!this->try_overwrite_front(byte))
-      return MemoryBlob::handle_overwrite_exception();
+      return error::handle_overwrite_exception();
   }
-  inline void MemoryBlob::overwrite_front(std::byte const* begin, std::byte const* end)
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::overwrite_front(std::byte const* begin, std::byte const* end)
   {
     if (!this->try_overwrite_front(begin, end))
-      return MemoryBlob::handle_overwrite_exception();
+      return error::handle_overwrite_exception();
   }
-  inline void MemoryBlob::overwrite_front(std::byte const* begin, std::size_t const& number_of_bytes)
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::overwrite_front(std::byte const* begin, std::size_t const& number_of_bytes)
   {
     if (!this->try_overwrite_front(begin, number_of_bytes))
-      return MemoryBlob::handle_overwrite_exception();
+      return error::handle_overwrite_exception();
   }
-  inline void MemoryBlob::overwrite_front(std::span<std::byte> const& data)
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::overwrite_front(std::span<std::byte> const& data)
   {
     if (!this->try_overwrite_front(data))
-      return MemoryBlob::handle_overwrite_exception();
+      return error::handle_overwrite_exception();
   }
-  inline void MemoryBlob::overwrite_reverse(std::size_t const& offset, std::byte const& byte)
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::overwrite_reverse(std::size_t const& offset, std::byte const& byte)
   {
     if (!this->try_overwrite_reverse(offset, byte))
-      return MemoryBlob::handle_overwrite_exception();
+      return error::handle_overwrite_exception();
   }
-  inline void MemoryBlob::overwrite_reverse(std::size_t const& offset, std::byte const* begin, std::byte const* end)
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::overwrite_reverse(std::size_t const& offset, std::byte const* begin, std::byte const* end)
   {
     if (!this->try_overwrite_reverse(offset, begin, end))
-      return MemoryBlob::handle_overwrite_exception();
+      return error::handle_overwrite_exception();
   }
-  inline void MemoryBlob::overwrite_reverse(std::size_t const& offset, std::span<std::byte> const& data)
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::overwrite_reverse(std::size_t const& offset, std::span<std::byte> const& data)
   {
     if (!this->try_overwrite_reverse(offset, data))
-      return MemoryBlob::handle_overwrite_exception();
+      return error::handle_overwrite_exception();
   }
-  inline void MemoryBlob::overwrite_back_reverse(std::byte const& byte)
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::overwrite_back_reverse(std::byte const& byte)
   {
     if (!this->try_overwrite_back_reverse(byte))
-      return MemoryBlob::handle_overwrite_exception();
+      return error::handle_overwrite_exception();
   }
-  inline void MemoryBlob::overwrite_back_reverse(std::byte const* begin, std::byte const* end)
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::overwrite_back_reverse(std::byte const* begin, std::byte const* end)
   {
     if (!this->try_overwrite_back_reverse(begin, end))
-      return MemoryBlob::handle_overwrite_exception();
+      return error::handle_overwrite_exception();
   }
-  inline void MemoryBlob::overwrite_back_reverse(std::byte const* begin, std::size_t const& number_of_bytes)
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::overwrite_back_reverse(std::byte const* begin, std::size_t const& number_of_bytes)
   {
     if (!this->try_overwrite_back_reverse(begin, number_of_bytes))
-      return MemoryBlob::handle_overwrite_exception();
+      return error::handle_overwrite_exception();
   }
-  inline void MemoryBlob::overwrite_back_reverse(std::span<std::byte> const& data)
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::overwrite_back_reverse(std::span<std::byte> const& data)
   {
     if (!this->try_overwrite_back_reverse(data))
-      return MemoryBlob::handle_overwrite_exception();
+      return error::handle_overwrite_exception();
   }
-  inline void MemoryBlob::overwrite_front_reverse(std::byte const& byte)
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::overwrite_front_reverse(std::byte const& byte)
   {
     if (!this->try_overwrite_front_reverse(byte))
-      return MemoryBlob::handle_overwrite_exception();
+      return error::handle_overwrite_exception();
   }
-  inline void MemoryBlob::overwrite_front_reverse(std::byte const* begin, std::byte const* end)
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::overwrite_front_reverse(std::byte const* begin, std::byte const* end)
   {
     if (!this->try_overwrite_front_reverse(begin, end))
-      return MemoryBlob::handle_overwrite_exception();
+      return error::handle_overwrite_exception();
   }
-  inline void MemoryBlob::overwrite_front_reverse(std::byte const* begin, std::size_t const& number_of_bytes)
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::overwrite_front_reverse(std::byte const* begin, std::size_t const& number_of_bytes)
   {
     if (!this->try_overwrite_front_reverse(begin, number_of_bytes))
-      return MemoryBlob::handle_overwrite_exception();
+      return error::handle_overwrite_exception();
   }
-  inline void MemoryBlob::overwrite_front_reverse(std::span<std::byte> const& data)
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::overwrite_front_reverse(std::span<std::byte> const& data)
   {
     if (!this->try_overwrite_front_reverse(data))
-      return MemoryBlob::handle_overwrite_exception();
+      return error::handle_overwrite_exception();
   }
-  inline void MemoryBlob::insert(std::size_t const& offset, std::byte const* begin, std::size_t const& number_of_bytes)
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::insert(std::size_t const& offset, std::byte const* begin, std::size_t const& number_of_bytes)
   {
     if (!this->try_insert(offset, begin, number_of_bytes))
-      return MemoryBlob::handle_insert_exception();
+      return error::handle_insert_exception();
   }
-  inline void MemoryBlob::insert_reverse(std::size_t const& offset, std::byte const* begin, std::size_t const& number_of_bytes)
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::insert_reverse(std::size_t const& offset, std::byte const* begin, std::size_t const& number_of_bytes)
   {
     if (!this->try_insert_reverse(offset, begin, number_of_bytes))
-      return MemoryBlob::handle_insert_exception();
+      return error::handle_insert_exception();
+  }
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::insert(std::size_t const& offset, std::byte const& byte) { return this->insert(offset, &byte, 1); }
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::insert(std::size_t const& offset, std::byte const* begin, std::byte const* end)
+  {
+    return this->insert(offset, begin, end - begin);
+  }
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::insert(std::size_t const& offset, std::span<std::byte> const& data)
+  {
+    return this->insert(offset, data.data(), data.size_bytes());
   }
-  inline void MemoryBlob::insert(std::size_t const& offset, std::byte const& byte) { return this->insert(offset, &byte, 1); }
-  inline void MemoryBlob::insert(std::size_t const& offset, std::byte const* begin, std::byte const* end) { return this->insert(offset, begin, end - begin); }
-  inline void MemoryBlob::insert(std::size_t const& offset, std::span<std::byte> const& data) { return this->insert(offset, data.data(), data.size_bytes()); }
-  inline void MemoryBlob::insert_back(std::byte const& byte) { return this->insert(this->m_pos_idx, byte); }
-  inline void MemoryBlob::insert_back(std::byte const* begin, std::byte const* end) { return this->insert(this->m_pos_idx, begin, end); }
-  inline void MemoryBlob::insert_back(std::byte const* begin, std::size_t const& number_of_bytes)
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::insert_back(std::byte const& byte) { return this->insert(this->m_pos_idx, byte); }
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::insert_back(std::byte const* begin, std::byte const* end) { return this->insert(this->m_pos_idx, begin, end); }
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::insert_back(std::byte const* begin, std::size_t const& number_of_bytes)
   {
     return this->insert(this->m_pos_idx, begin, number_of_bytes);
   }
-  inline void MemoryBlob::insert_back(std::span<std::byte> const& data) { return this->insert(this->m_pos_idx, data); }
-  inline void MemoryBlob::insert_front(std::byte const& byte) { return this->insert(0, byte); }
-  inline void MemoryBlob::insert_front(std::byte const* begin, std::byte const* end) { return this->insert(0, begin, end); }
-  inline void MemoryBlob::insert_front(std::byte const* begin, std::size_t const& number_of_bytes) { return this->insert(0, begin, number_of_bytes); }
-  inline void MemoryBlob::insert_front(std::span<std::byte> const& data) { return this->insert(0, data); }
-  inline void MemoryBlob::insert_reverse(std::size_t const& offset, std::byte const& byte) { return this->insert_reverse(offset, &byte, 1); }
-  inline void MemoryBlob::insert_reverse(std::size_t const& offset, std::byte const* begin, std::byte const* end)
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::insert_back(std::span<std::byte> const& data) { return this->insert(this->m_pos_idx, data); }
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::insert_front(std::byte const& byte) { return this->insert(0, byte); }
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::insert_front(std::byte const* begin, std::byte const* end) { return this->insert(0, begin, end); }
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::insert_front(std::byte const* begin, std::size_t const& number_of_bytes)
+  {
+    return this->insert(0, begin, number_of_bytes);
+  }
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::insert_front(std::span<std::byte> const& data) { return this->insert(0, data); }
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::insert_reverse(std::size_t const& offset, std::byte const& byte) { return this->insert_reverse(offset, &byte, 1); }
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::insert_reverse(std::size_t const& offset, std::byte const* begin, std::byte const* end)
   {
     return this->insert_reverse(offset, begin, end - begin);
   }
-  inline void MemoryBlob::insert_reverse(std::size_t const& offset, std::span<std::byte> const& data)
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::insert_reverse(std::size_t const& offset, std::span<std::byte> const& data)
   {
     return this->insert_reverse(offset, data.data(), data.size_bytes());
   }
-  inline void MemoryBlob::insert_back_reverse(std::byte const& byte) { return this->insert_reverse(this->m_pos_idx, byte); }
-  inline void MemoryBlob::insert_back_reverse(std::byte const* begin, std::byte const* end) { return this->insert_reverse(this->m_pos_idx, begin, end); }
-  inline void MemoryBlob::insert_back_reverse(std::byte const* begin, std::size_t const& number_of_bytes)
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::insert_back_reverse(std::byte const& byte) { return this->insert_reverse(this->m_pos_idx, byte); }
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::insert_back_reverse(std::byte const* begin, std::byte const* end)
+  {
+    return this->insert_reverse(this->m_pos_idx, begin, end);
+  }
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::insert_back_reverse(std::byte const* begin, std::size_t const& number_of_bytes)
   {
     return this->insert_reverse(this->m_pos_idx, begin, number_of_bytes);
   }
-  inline void MemoryBlob::insert_back_reverse(std::span<std::byte> const& data) { return this->insert_reverse(this->m_pos_idx, data); }
-  inline void MemoryBlob::insert_front_reverse(std::byte const& byte) { return this->insert_reverse(0, byte); }
-  inline void MemoryBlob::insert_front_reverse(std::byte const* begin, std::byte const* end) { return this->insert_reverse(0, begin, end); }
-  inline void MemoryBlob::insert_front_reverse(std::byte const* begin, std::size_t const& number_of_bytes)
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::insert_back_reverse(std::span<std::byte> const& data) { return this->insert_reverse(this->m_pos_idx, data); }
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::insert_front_reverse(std::byte const& byte) { return this->insert_reverse(0, byte); }
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::insert_front_reverse(std::byte const* begin, std::byte const* end) { return this->insert_reverse(0, begin, end); }
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::insert_front_reverse(std::byte const* begin, std::size_t const& number_of_bytes)
   {
     return this->insert_reverse(0, begin, number_of_bytes);
   }
-  inline void MemoryBlob::insert_front_reverse(std::span<std::byte> const& data) { return this->insert_reverse(0, data); }
-  inline void MemoryBlob::remove(std::size_t const& offset, std::size_t const& number_of_bytes)
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::insert_front_reverse(std::span<std::byte> const& data) { return this->insert_reverse(0, data); }
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::remove(std::size_t const& offset, std::size_t const& number_of_bytes)
   {
     if (!this->try_remove(offset, number_of_bytes))
-      return MemoryBlob::handle_remove_exception();
+      return error::handle_remove_exception();
   }
-  inline void MemoryBlob::remove_back(std::size_t const& number_of_bytes)
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::remove_back(std::size_t const& number_of_bytes)
   {
     if (this->m_pos_idx < number_of_bytes)
-      return MemoryBlob::handle_remove_exception();
+      return error::handle_remove_exception();
     return this->remove(this->m_pos_idx - number_of_bytes, number_of_bytes);
   }
-  inline void        MemoryBlob::remove_front(std::size_t const& number_of_bytes) { return this->remove(0, number_of_bytes); }
-  inline std::size_t MemoryBlob::data_shift_right(std::byte* data, std::size_t const& size, std::size_t const& offset, std::size_t const& shift)
+  template <typename Tblob>
+  inline constexpr void Blob_Interface<Tblob>::remove_front(std::size_t const& number_of_bytes) { return this->remove(0, number_of_bytes); }
+  template <typename Tblob>
+  inline constexpr std::size_t Blob_Interface<Tblob>::data_shift_right(std::byte* data, std::size_t const& size, std::size_t const& offset, std::size_t const& shift)
   {
     for (std::size_t i = size + shift; i > (offset + shift);)
     {
@@ -870,7 +1730,8 @@ namespace wlib::blob
     }
     return shift;
   }
-  inline std::size_t MemoryBlob::data_shift_left(std::byte* data, std::size_t const& size, std::size_t const& offset, std::size_t const& shift)
+  template <typename Tblob>
+  inline constexpr std::size_t Blob_Interface<Tblob>::data_shift_left(std::byte* data, std::size_t const& size, std::size_t const& offset, std::size_t const& shift)
   {
     for (std::size_t i = offset; i < size - shift; i++)
     {
@@ -878,7 +1739,8 @@ namespace wlib::blob
     }
     return shift;
   }
-  inline std::size_t MemoryBlob::byte_copy(std::byte* dst, std::byte const* src, std::size_t const& size)
+  template <typename Tblob>
+  inline constexpr std::size_t Blob_Interface<Tblob>::byte_copy(std::byte* dst, std::byte const* src, std::size_t const& size)
   {
     for (std::size_t idx = 0; idx < size; idx++)
     {
@@ -886,7 +1748,18 @@ namespace wlib::blob
     }
     return size;
   }
-  inline std::size_t MemoryBlob::byte_copy_reverse(std::byte* dst, std::byte const* src, std::size_t const& size)
+  template <typename Tblob>
+  inline void Blob_Interface<Tblob>::bulk_copy(std::byte* dst, std::byte const* src, std::size_t const& number_of_elements, std::size_t const& element_size, std::endian endian)
+  {
+    if (number_of_elements == 0)
+      return;
+    if (endian == std::endian::native || element_size == 1)
+      std::memcpy(dst, src, number_of_elements * element_size);
+    else
+      wlib::blob::byteswap_copy(dst, src, number_of_elements, element_size);
+  }
+  template <typename Tblob>
+  inline constexpr std::size_t Blob_Interface<Tblob>::byte_copy_reverse(std::byte* dst, std::byte const* src, std::size_t const& size)
   {
     for (std::size_t idx = 0; idx < size; idx++)
     {
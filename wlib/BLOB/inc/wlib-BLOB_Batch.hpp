@@ -0,0 +1,95 @@
+#pragma once
+#ifndef WLIB_BLOB_BATCH_HPP_INCLUDED
+#define WLIB_BLOB_BATCH_HPP_INCLUDED
+
+#include <wlib-BLOB.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <span>
+
+namespace wlib::blob
+{
+  // Removes number_of_removed_bytes at offset and inserts data there. Offsets refer to the blob before the batch.
+  struct blob_edit
+  {
+    std::size_t                offset                  = 0;
+    std::size_t                number_of_removed_bytes = 0;
+    std::span<std::byte const> data;
+
+    [[nodiscard]] static constexpr blob_edit insert(std::size_t const& offset, std::span<std::byte const> const& data) noexcept { return { offset, 0, data }; }
+    [[nodiscard]] static constexpr blob_edit remove(std::size_t const& offset, std::size_t const& number_of_bytes) noexcept { return { offset, number_of_bytes, {} }; }
+    [[nodiscard]] static constexpr blob_edit replace(std::size_t const& offset, std::size_t const& number_of_bytes, std::span<std::byte const> const& data) noexcept
+    {
+      return { offset, number_of_bytes, data };
+    }
+  };
+
+  // Size of the blob after the batch, false if the edits are unsorted, overlap or reach past number_of_bytes.
+  [[nodiscard]] constexpr bool try_measure_edits(std::size_t const& number_of_bytes, std::span<blob_edit const> const& edits, std::size_t& result) noexcept
+  {
+    std::size_t end  = 0;
+    std::size_t size = number_of_bytes;
+    for (blob_edit const& edit : edits)
+    {
+      if ((edit.offset < end) || (number_of_bytes < edit.offset) || ((number_of_bytes - edit.offset) < edit.number_of_removed_bytes))
+        return false;
+      end  = edit.offset + edit.number_of_removed_bytes;
+      size = size - edit.number_of_removed_bytes + edit.data.size();
+    }
+    result = size;
+    return true;
+  }
+
+  // Applies all edits in one pass, each kept byte is moved at most once: segments moving towards the
+  // front are moved first from left to right, then the ones moving towards the back from right to left,
+  // the inserted data is copied last. Either the whole batch is applied or the blob is left untouched.
+  // The inserted data must not point into the blob.
+  template <typename Tblob> bool try_edit(Blob_Interface<Tblob>& blob, std::span<blob_edit const> const& edits) noexcept
+  {
+    std::size_t const used = blob.get_number_of_used_bytes();
+    std::size_t       size = 0;
+    if (!wlib::blob::try_measure_edits(used, edits, size) || (blob.get_total_number_of_bytes() < size))
+      return false;
+
+    // The kept segment idx starts after edit idx - 1 and ends at edit idx (or at the end of the blob).
+    std::byte* const data          = blob.get_blob().data();
+    auto const       segment_begin = [&edits](std::size_t const& idx) { return (idx == 0) ? 0 : (edits[idx - 1].offset + edits[idx - 1].number_of_removed_bytes); };
+    auto const       segment_end   = [&edits, used](std::size_t const& idx) { return (idx == edits.size()) ? used : edits[idx].offset; };
+
+    std::ptrdiff_t shift = 0;
+    for (std::size_t idx = 0; idx <= edits.size(); idx++)
+    {
+      if (idx != 0)
+        shift += static_cast<std::ptrdiff_t>(edits[idx - 1].data.size()) - static_cast<std::ptrdiff_t>(edits[idx - 1].number_of_removed_bytes);
+      std::size_t const begin = segment_begin(idx);
+      if ((shift < 0) && (begin != segment_end(idx)))
+        std::memmove(data + begin + shift, data + begin, segment_end(idx) - begin);
+    }
+    for (std::size_t idx = edits.size() + 1; idx != 0; idx--)
+    {
+      std::size_t const begin = segment_begin(idx - 1);
+      if ((shift > 0) && (begin != segment_end(idx - 1)))
+        std::memmove(data + begin + shift, data + begin, segment_end(idx - 1) - begin);
+      if (idx != 1)
+        shift -= static_cast<std::ptrdiff_t>(edits[idx - 2].data.size()) - static_cast<std::ptrdiff_t>(edits[idx - 2].number_of_removed_bytes);
+    }
+
+    // shift is back to zero, walk forward again to place the inserted data.
+    for (blob_edit const& edit : edits)
+    {
+      if (!edit.data.empty())
+        std::memcpy(data + edit.offset + shift, edit.data.data(), edit.data.size());
+      shift += static_cast<std::ptrdiff_t>(edit.data.size()) - static_cast<std::ptrdiff_t>(edit.number_of_removed_bytes);
+    }
+    return blob.try_set_position(size);
+  }
+
+  template <typename Tblob> void edit(Blob_Interface<Tblob>& blob, std::span<blob_edit const> const& edits)
+  {
+    if (!wlib::blob::try_edit(blob, edits))
+      return error::handle_insert_exception();
+  }
+}    // namespace wlib::blob
+
+#endif    // !WLIB_BLOB_BATCH_HPP_INCLUDED
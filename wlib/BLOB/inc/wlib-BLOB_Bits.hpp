@@ -0,0 +1,232 @@
+#pragma once
+#ifndef WLIB_BLOB_BITS_HPP_INCLUDED
+#define WLIB_BLOB_BITS_HPP_INCLUDED
+
+#include <wlib-BLOB.hpp>
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace wlib::blob
+{
+  enum class bit_order
+  {
+    msb_first,
+    lsb_first
+  };
+
+  namespace bits
+  {
+    [[nodiscard]] constexpr uint64_t mask(std::size_t const& number_of_bits) noexcept
+    {
+      return (number_of_bits >= 64) ? ~uint64_t(0) : ((uint64_t(1) << number_of_bits) - 1);
+    }
+  }    // namespace bits
+
+  // Packs bit fields into a 64 bit accumulator and appends it to the blob a whole word at a time.
+  // Call flush() to append the remaining bits, the last byte is padded with zeros.
+  template <typename Tblob, bit_order order = bit_order::msb_first> class BitWriter
+  {
+  public:
+    constexpr BitWriter(Blob_Interface<Tblob>& blob) noexcept
+        : m_blob(&blob)
+    {
+    }
+
+    [[nodiscard]] constexpr std::size_t get_number_of_pending_bits() const noexcept { return this->m_count; }
+
+    constexpr bool try_write_bits(uint64_t const& value, std::size_t const& number_of_bits) noexcept
+    {
+      if (number_of_bits > 64)
+        return false;
+      if (number_of_bits == 0)
+        return true;
+
+      uint64_t const    bits         = value & bits::mask(number_of_bits);
+      std::size_t const free_of_word = 64 - this->m_count;
+      if (number_of_bits < free_of_word)
+      {
+        if constexpr (order == bit_order::msb_first)
+          this->m_acc = (this->m_acc << number_of_bits) | bits;
+        else
+          this->m_acc |= bits << this->m_count;
+        this->m_count += number_of_bits;
+        return true;
+      }
+
+      if (this->m_blob->get_number_of_free_bytes() < sizeof(uint64_t))
+        return false;
+
+      std::size_t const rest = number_of_bits - free_of_word;
+      if constexpr (order == bit_order::msb_first)
+      {
+        uint64_t const word = (free_of_word == 64) ? bits : ((this->m_acc << free_of_word) | (bits >> rest));
+        this->m_blob->template try_insert_back<uint64_t, std::endian::big>(word);
+        this->m_acc = bits & bits::mask(rest);
+      }
+      else
+      {
+        this->m_blob->template try_insert_back<uint64_t, std::endian::little>(this->m_acc | (bits << this->m_count));
+        this->m_acc = (free_of_word == 64) ? 0 : (bits >> free_of_word);
+      }
+      this->m_count = rest;
+      return true;
+    }
+
+    constexpr bool try_flush() noexcept
+    {
+      std::array<std::byte, sizeof(uint64_t)> raw{};
+      std::size_t const                       number_of_bytes = (this->m_count + 7) / 8;
+      for (std::size_t idx = 0; idx < number_of_bytes; idx++)
+      {
+        if constexpr (order == bit_order::msb_first)
+          raw[idx] = static_cast<std::byte>((this->m_acc << (64 - this->m_count)) >> (56 - 8 * idx));
+        else
+          raw[idx] = static_cast<std::byte>(this->m_acc >> (8 * idx));
+      }
+      if (!this->m_blob->try_insert_back(raw.data(), number_of_bytes))
+        return false;
+
+      this->m_acc   = 0;
+      this->m_count = 0;
+      return true;
+    }
+
+    constexpr void write_bits(uint64_t const& value, std::size_t const& number_of_bits)
+    {
+      if (!this->try_write_bits(value, number_of_bits))
+        return error::handle_insert_exception();
+    }
+
+    constexpr void flush()
+    {
+      if (!this->try_flush())
+        return error::handle_insert_exception();
+    }
+
+  private:
+    Blob_Interface<Tblob>* m_blob;
+    uint64_t               m_acc   = 0;
+    std::size_t            m_count = 0;
+  };
+
+  // Reads bit fields from the used bytes of a blob, refilling a 64 bit accumulator a whole word at a time.
+  template <typename Tblob, bit_order order = bit_order::msb_first> class BitReader
+  {
+  public:
+    constexpr BitReader(Blob_Interface<Tblob> const& blob, std::size_t const& offset = 0) noexcept
+        : m_blob(&blob)
+        , m_byte_idx(offset)
+    {
+    }
+
+    [[nodiscard]] constexpr std::size_t get_number_of_remaining_bits() const noexcept
+    {
+      std::size_t const size = this->m_blob->get_number_of_used_bytes();
+      return this->m_count + ((size > this->m_byte_idx) ? (size - this->m_byte_idx) * 8 : 0);
+    }
+
+    constexpr bool try_read_bits(uint64_t& value, std::size_t const& number_of_bits) noexcept
+    {
+      if ((number_of_bits > 64) || (this->get_number_of_remaining_bits() < number_of_bits))
+        return false;
+
+      if (number_of_bits <= this->m_count)
+      {
+        if constexpr (order == bit_order::msb_first)
+        {
+          value = (this->m_acc >> (this->m_count - number_of_bits)) & bits::mask(number_of_bits);
+          this->m_acc &= bits::mask(this->m_count - number_of_bits);
+        }
+        else
+        {
+          value       = this->m_acc & bits::mask(number_of_bits);
+          this->m_acc = (number_of_bits == 64) ? 0 : (this->m_acc >> number_of_bits);
+        }
+        this->m_count -= number_of_bits;
+        return true;
+      }
+
+      std::size_t const need   = number_of_bits - this->m_count;
+      std::size_t       loaded = 0;
+      uint64_t const    word   = this->load(loaded);
+      if constexpr (order == bit_order::msb_first)
+      {
+        uint64_t const high = (need == 64) ? 0 : (this->m_acc << need);
+        value               = high | (word >> (loaded - need));
+        this->m_acc         = word & bits::mask(loaded - need);
+      }
+      else
+      {
+        value       = this->m_acc | ((word & bits::mask(need)) << this->m_count);
+        this->m_acc = (need == 64) ? 0 : (word >> need);
+      }
+      this->m_count = loaded - need;
+      return true;
+    }
+
+    // drops the bits left of a partially consumed byte
+    constexpr void align() noexcept
+    {
+      std::size_t const drop = this->m_count % 8;
+      if constexpr (order == bit_order::msb_first)
+        this->m_acc &= bits::mask(this->m_count - drop);
+      else
+        this->m_acc >>= drop;
+      this->m_count -= drop;
+    }
+
+    [[nodiscard]] constexpr uint64_t read_bits(std::size_t const& number_of_bits)
+    {
+      uint64_t value = 0;
+      if (!this->try_read_bits(value, number_of_bits))
+        error::handle_read_exception();
+      return value;
+    }
+
+  private:
+    constexpr uint64_t load(std::size_t& number_of_bits) noexcept
+    {
+      uint64_t word = 0;
+      if constexpr (order == bit_order::msb_first)
+      {
+        if (this->m_blob->template try_read<uint64_t, std::endian::big>(this->m_byte_idx, word))
+        {
+          this->m_byte_idx += sizeof(uint64_t);
+          number_of_bits = 64;
+          return word;
+        }
+      }
+      else
+      {
+        if (this->m_blob->template try_read<uint64_t, std::endian::little>(this->m_byte_idx, word))
+        {
+          this->m_byte_idx += sizeof(uint64_t);
+          number_of_bits = 64;
+          return word;
+        }
+      }
+
+      std::span<std::byte const> const data = this->m_blob->get_blob().subspan(this->m_byte_idx);
+      for (std::size_t idx = 0; idx < data.size(); idx++)
+      {
+        if constexpr (order == bit_order::msb_first)
+          word = (word << 8) | static_cast<uint64_t>(data[idx]);
+        else
+          word |= static_cast<uint64_t>(data[idx]) << (8 * idx);
+      }
+      this->m_byte_idx += data.size();
+      number_of_bits = data.size() * 8;
+      return word;
+    }
+
+    Blob_Interface<Tblob> const* m_blob;
+    std::size_t                  m_byte_idx;
+    uint64_t                     m_acc   = 0;
+    std::size_t                  m_count = 0;
+  };
+}    // namespace wlib::blob
+
+#endif    // !WLIB_BLOB_BITS_HPP_INCLUDED
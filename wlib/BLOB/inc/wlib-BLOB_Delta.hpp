@@ -0,0 +1,73 @@
+#pragma once
+#ifndef WLIB_BLOB_DELTA_HPP_INCLUDED
+#define WLIB_BLOB_DELTA_HPP_INCLUDED
+
+#include <wlib-BLOB.hpp>
+#include <wlib-BLOB_Varint.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+// Delta between two versions of a blob: [varint new size] followed by runs of
+// [varint unchanged bytes][varint changed bytes][changed bytes]. Runs cover whole 8 byte words,
+// unchanged stretches are skipped with a SIMD compare.
+namespace wlib::blob::delta
+{
+  inline constexpr std::size_t word_size = 8;
+
+  // Worst case: every other word changed.
+  [[nodiscard]] constexpr std::size_t max_encoded_size(std::size_t const& number_of_bytes) noexcept
+  {
+    return varint::max_size_v<std::uint64_t> + (number_of_bytes / (2 * word_size) + 2) * 2 * varint::max_size_v<std::uint64_t> + number_of_bytes;
+  }
+
+  // Returns the bytes written, 0 if capacity was too small.
+  std::size_t encode(std::byte* dst, std::size_t const& capacity, std::span<std::byte const> const& previous, std::span<std::byte const> const& current) noexcept;
+  // Checks that the delta is well formed and fits into capacity bytes.
+  bool validate(std::span<std::byte const> const& delta, std::size_t const& capacity, std::size_t& new_number_of_bytes) noexcept;
+
+  template <typename Tblob>
+  bool try_encode_back(Blob_Interface<Tblob>& dst, std::span<std::byte const> const& previous, std::span<std::byte const> const& current) noexcept
+  {
+    std::size_t const number_of_bytes = delta::encode(dst.get_blob().data() + dst.get_number_of_used_bytes(), dst.get_number_of_free_bytes(), previous, current);
+    return (number_of_bytes != 0) && dst.try_adjust_position(static_cast<std::ptrdiff_t>(number_of_bytes));
+  }
+
+  // Turns the previous version in blob into the current one. The delta is validated first,
+  // a malformed delta leaves the blob untouched.
+  template <typename Tblob> bool try_apply(Blob_Interface<Tblob>& blob, std::span<std::byte const> const& delta) noexcept
+  {
+    std::size_t number_of_bytes = 0;
+    if (!delta::validate(delta, blob.get_total_number_of_bytes(), number_of_bytes))
+      return false;
+    blob.try_set_position(number_of_bytes);
+
+    std::uint64_t value  = 0;
+    std::size_t   idx    = varint::decode(delta.data(), delta.size(), value);
+    std::size_t   offset = 0;
+    while (idx < delta.size())
+    {
+      idx += varint::decode(delta.data() + idx, delta.size() - idx, value);
+      offset += static_cast<std::size_t>(value);
+      idx += varint::decode(delta.data() + idx, delta.size() - idx, value);
+      blob.try_overwrite(offset, delta.data() + idx, static_cast<std::size_t>(value));
+      idx += static_cast<std::size_t>(value);
+      offset += static_cast<std::size_t>(value);
+    }
+    return true;
+  }
+
+  template <typename Tblob> void encode_back(Blob_Interface<Tblob>& dst, std::span<std::byte const> const& previous, std::span<std::byte const> const& current)
+  {
+    if (!delta::try_encode_back(dst, previous, current))
+      return error::handle_insert_exception();
+  }
+  template <typename Tblob> void apply(Blob_Interface<Tblob>& blob, std::span<std::byte const> const& delta)
+  {
+    if (!delta::try_apply(blob, delta))
+      return error::handle_overwrite_exception();
+  }
+}    // namespace wlib::blob::delta
+
+#endif    // !WLIB_BLOB_DELTA_HPP_INCLUDED
@@ -0,0 +1,79 @@
+#pragma once
+#ifndef WLIB_BLOB_FILE_HPP_INCLUDED
+#define WLIB_BLOB_FILE_HPP_INCLUDED
+
+#include <wlib-BLOB.hpp>
+
+#include <cstddef>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define WLIB_BLOB_FILE_MAPPING 1
+
+namespace wlib::blob
+{
+  namespace error
+  {
+    void handle_file_exception();
+  }    // namespace error
+
+  enum class file_access
+  {
+    read_only,
+    read_write
+  };
+
+  enum class file_advice
+  {
+    normal,
+    sequential,
+    random,
+    will_need,
+    dont_need
+  };
+
+  struct file_options
+  {
+    bool populate   = false;    // prefault all pages on open
+    bool huge_pages = false;    // ask for transparent huge pages, ignored if unsupported
+  };
+
+  // Maps a whole file into memory. Reading and overwriting is done through views, a
+  // read_write mapping is shared, so overwritten bytes end up in the file.
+  class FileBlob
+  {
+  public:
+    FileBlob() noexcept = default;
+    FileBlob(FileBlob const&)            = delete;
+    FileBlob& operator=(FileBlob const&) = delete;
+    FileBlob(FileBlob&& other) noexcept;
+    FileBlob& operator=(FileBlob&& other) noexcept;
+    ~FileBlob();
+
+    [[nodiscard]] bool          is_open() const noexcept { return this->m_fd >= 0; }
+    [[nodiscard]] std::size_t   get_number_of_bytes() const noexcept { return this->m_size; }
+    [[nodiscard]] file_access   get_access() const noexcept { return this->m_access; }
+    [[nodiscard]] ConstBlobView get_view() const noexcept { return ConstBlobView(this->m_data, this->m_size); }
+    [[nodiscard]] BlobView      get_writable_view() noexcept;
+
+    bool try_open(char const* path, file_access access = file_access::read_only, file_options const& options = {}) noexcept;
+    bool try_advise(std::size_t const& offset, std::size_t const& number_of_bytes, file_advice advice) noexcept;
+    bool try_advise(file_advice advice) noexcept { return this->try_advise(0, this->m_size, advice); }
+    bool try_sync(std::size_t const& offset, std::size_t const& number_of_bytes, bool wait = true) noexcept;
+    bool try_sync(bool wait = true) noexcept { return this->try_sync(0, this->m_size, wait); }
+    void close() noexcept;
+
+    void open(char const* path, file_access access = file_access::read_only, file_options const& options = {});
+    void advise(file_advice advice);
+    void sync(bool wait = true);
+
+  private:
+    std::byte*  m_data   = nullptr;
+    std::size_t m_size   = 0;
+    int         m_fd     = -1;
+    file_access m_access = file_access::read_only;
+  };
+}    // namespace wlib::blob
+
+#endif
+
+#endif    // !WLIB_BLOB_FILE_HPP_INCLUDED
@@ -0,0 +1,164 @@
+#pragma once
+#ifndef WLIB_BLOB_FRAME_HPP_INCLUDED
+#define WLIB_BLOB_FRAME_HPP_INCLUDED
+
+#include <wlib-BLOB.hpp>
+#include <wlib-CRC_Interface.hpp>
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <span>
+
+namespace wlib::blob
+{
+  enum class length_scope
+  {
+    payload,    // the length field counts the payload bytes only
+    frame       // the length field counts length field, payload and CRC
+  };
+
+  // Layout of a frame: [length][payload][crc]. The CRC covers the payload.
+  template <std::unsigned_integral Tlength, std::unsigned_integral Tcrc, std::endian length_endian = std::endian::big,
+            std::endian crc_endian = length_endian, length_scope scope = length_scope::payload>
+  struct frame_format
+  {
+    using length_type = Tlength;
+    using crc_type    = Tcrc;
+
+    static constexpr std::size_t  length_size = sizeof(Tlength);
+    static constexpr std::size_t  crc_size    = sizeof(Tcrc);
+    static constexpr std::size_t  overhead    = length_size + crc_size;
+    static constexpr std::endian  length_end  = length_endian;
+    static constexpr std::endian  crc_end     = crc_endian;
+    static constexpr length_scope length_of   = scope;
+  };
+
+  // Builds one frame at a time at the back of a blob. begin() reserves the length field and the
+  // trailer, the payload is streamed through the CRC while it is appended and commit() patches
+  // the length and appends the CRC without another pass over the payload.
+  template <typename Tformat, typename Tblob> class FrameBuilder
+  {
+  public:
+    using length_type = typename Tformat::length_type;
+    using crc_type    = typename Tformat::crc_type;
+
+    FrameBuilder(Blob_Interface<Tblob>& blob, crc::CRC_Interface<crc_type>& crc) noexcept
+        : m_blob(&blob)
+        , m_crc(&crc)
+    {
+    }
+
+    [[nodiscard]] bool        is_open() const noexcept { return this->m_open; }
+    [[nodiscard]] std::size_t get_number_of_payload_bytes() const noexcept
+    {
+      return this->m_open ? (this->m_blob->get_number_of_used_bytes() - this->m_start - Tformat::length_size) : 0;
+    }
+    // Payload bytes which still fit in front of the reserved trailer.
+    [[nodiscard]] std::size_t get_number_of_free_bytes() const noexcept
+    {
+      std::size_t const free = this->m_blob->get_number_of_free_bytes();
+      return (this->m_open && (Tformat::crc_size <= free)) ? (free - Tformat::crc_size) : 0;
+    }
+
+    bool try_begin() noexcept
+    {
+      if (this->m_open || (this->m_blob->get_number_of_free_bytes() < Tformat::overhead))
+        return false;
+
+      this->m_start = this->m_blob->get_number_of_used_bytes();
+      this->m_blob->try_adjust_position(static_cast<std::ptrdiff_t>(Tformat::length_size));
+      this->m_crc->reset();
+      this->m_open = true;
+      return true;
+    }
+
+    bool try_insert_back(std::byte const* begin, std::size_t const& number_of_bytes) noexcept
+    {
+      if (this->get_number_of_free_bytes() < number_of_bytes)
+        return false;
+      this->m_blob->try_insert_back(begin, number_of_bytes);
+      this->m_crc->operator()(begin, number_of_bytes);
+      return true;
+    }
+    bool try_insert_back(std::byte const& byte) noexcept { return this->try_insert_back(&byte, 1); }
+    bool try_insert_back(std::span<std::byte const> const& data) noexcept { return this->try_insert_back(data.data(), data.size()); }
+    template <ArithmeticOrByte T> bool try_insert_back(T const& value, std::endian endian = std::endian::native) noexcept
+    {
+      if (this->get_number_of_free_bytes() < sizeof(T))
+        return false;
+      this->m_blob->try_insert_back(value, endian);
+      this->m_crc->operator()(this->m_blob->get_blob().last(sizeof(T)));
+      return true;
+    }
+    template <ArithmeticOrByte T, std::endian endian> bool try_insert_back(T const& value) noexcept
+    {
+      if (this->get_number_of_free_bytes() < sizeof(T))
+        return false;
+      this->m_blob->template try_insert_back<T, endian>(value);
+      this->m_crc->operator()(this->m_blob->get_blob().last(sizeof(T)));
+      return true;
+    }
+
+    // Patches the length field and appends the CRC. Fails if the length does not fit into length_type.
+    bool try_commit() noexcept
+    {
+      if (!this->m_open)
+        return false;
+
+      std::size_t length = this->get_number_of_payload_bytes();
+      if constexpr (Tformat::length_of == length_scope::frame)
+        length += Tformat::overhead;
+      if (std::numeric_limits<length_type>::max() < length)
+        return false;
+
+      this->m_blob->template try_overwrite<length_type, Tformat::length_end>(this->m_start, static_cast<length_type>(length));
+      this->m_blob->template try_insert_back<crc_type, Tformat::crc_end>(this->m_crc->get());
+      this->m_open = false;
+      return true;
+    }
+
+    // Drops the open frame.
+    void abort() noexcept
+    {
+      if (this->m_open)
+        this->m_blob->try_set_position(this->m_start);
+      this->m_open = false;
+    }
+
+    void begin()
+    {
+      if (!this->try_begin())
+        return error::handle_insert_exception();
+    }
+    void insert_back(std::span<std::byte const> const& data)
+    {
+      if (!this->try_insert_back(data))
+        return error::handle_insert_exception();
+    }
+    template <ArithmeticOrByte T> void insert_back(T const& value, std::endian endian = std::endian::native)
+    {
+      if (!this->try_insert_back(value, endian))
+        return error::handle_insert_exception();
+    }
+    template <ArithmeticOrByte T, std::endian endian> void insert_back(T const& value)
+    {
+      if (!this->template try_insert_back<T, endian>(value))
+        return error::handle_insert_exception();
+    }
+    void commit()
+    {
+      if (!this->try_commit())
+        return error::handle_insert_exception();
+    }
+
+  private:
+    Blob_Interface<Tblob>*        m_blob;
+    crc::CRC_Interface<crc_type>* m_crc;
+    std::size_t                   m_start = 0;
+    bool                          m_open  = false;
+  };
+}    // namespace wlib::blob
+
+#endif    // !WLIB_BLOB_FRAME_HPP_INCLUDED
@@ -0,0 +1,92 @@
+#pragma once
+#ifndef WLIB_BLOB_IO_HPP_INCLUDED
+#define WLIB_BLOB_IO_HPP_INCLUDED
+
+#include <wlib-BLOB.hpp>
+#include <wlib-BLOB_File.hpp>
+
+#include <array>
+#include <cstddef>
+#include <span>
+
+#if defined(WLIB_BLOB_FILE_MAPPING)
+
+namespace wlib::blob::io
+{
+  // Write all buffers with as few writev/pwritev calls as possible, partial writes and EINTR are continued.
+  // number_of_bytes is the amount written, also if an error (e.g. EAGAIN) stopped the write.
+  bool try_writev(int fd, std::span<std::span<std::byte const> const> const& buffers, std::size_t& number_of_bytes) noexcept;
+  bool try_pwritev(int fd, std::size_t const& offset, std::span<std::span<std::byte const> const> const& buffers, std::size_t& number_of_bytes) noexcept;
+  bool try_writev(int fd, std::span<std::span<std::byte const> const> const& buffers) noexcept;
+  bool try_pwritev(int fd, std::size_t const& offset, std::span<std::span<std::byte const> const> const& buffers) noexcept;
+
+  // Reads until all buffers are full or the end of the file is reached. On a non-blocking descriptor
+  // EAGAIN after some data ends the read successfully. number_of_bytes is the amount received, also on failure.
+  bool try_readv(int fd, std::span<std::span<std::byte> const> const& buffers, std::size_t& number_of_bytes) noexcept;
+
+  template <typename T> [[nodiscard]] constexpr std::span<std::byte const> to_span(T const& part) noexcept
+  {
+    if constexpr (requires { part.get_blob(); })
+      return part.get_blob();
+    else
+      return std::span<std::byte const>(part);
+  }
+
+  // Each part is a blob (its used bytes are written) or anything convertible to std::span<std::byte const>.
+  template <typename... Tparts> requires(sizeof...(Tparts) > 0) bool try_write(int fd, Tparts const&... parts) noexcept
+  {
+    std::array<std::span<std::byte const>, sizeof...(Tparts)> const buffers{ io::to_span(parts)... };
+    return io::try_writev(fd, buffers);
+  }
+
+  template <typename... Tparts> requires(sizeof...(Tparts) > 0) bool try_pwrite(int fd, std::size_t const& offset, Tparts const&... parts) noexcept
+  {
+    std::array<std::span<std::byte const>, sizeof...(Tparts)> const buffers{ io::to_span(parts)... };
+    return io::try_pwritev(fd, offset, buffers);
+  }
+
+  template <typename Tblob> constexpr std::size_t advance(Blob_Interface<Tblob>& blob, std::size_t const& number_of_bytes) noexcept
+  {
+    std::size_t const step = (blob.get_number_of_free_bytes() < number_of_bytes) ? blob.get_number_of_free_bytes() : number_of_bytes;
+    blob.try_adjust_position(static_cast<std::ptrdiff_t>(step));
+    return step;
+  }
+
+  // Fills the free bytes of the blobs in order and advances their positions by the bytes received,
+  // bytes received before an error are kept as well.
+  template <typename... Tblobs> requires(sizeof...(Tblobs) > 0) bool try_read(int fd, std::size_t& number_of_bytes, Blob_Interface<Tblobs>&... blobs) noexcept
+  {
+    std::array<std::span<std::byte>, sizeof...(Tblobs)> const buffers{
+      std::span<std::byte>(blobs.get_blob().data() + blobs.get_number_of_used_bytes(), blobs.get_number_of_free_bytes())...
+    };
+    bool const ret = io::try_readv(fd, buffers, number_of_bytes);
+
+    std::size_t left = number_of_bytes;
+    ((left -= io::advance(blobs, left)), ...);
+    return ret;
+  }
+
+  template <typename... Tparts> requires(sizeof...(Tparts) > 0) void write(int fd, Tparts const&... parts)
+  {
+    if (!io::try_write(fd, parts...))
+      return error::handle_file_exception();
+  }
+
+  template <typename... Tparts> requires(sizeof...(Tparts) > 0) void pwrite(int fd, std::size_t const& offset, Tparts const&... parts)
+  {
+    if (!io::try_pwrite(fd, offset, parts...))
+      return error::handle_file_exception();
+  }
+
+  template <typename... Tblobs> requires(sizeof...(Tblobs) > 0) [[nodiscard]] std::size_t read(int fd, Blob_Interface<Tblobs>&... blobs)
+  {
+    std::size_t number_of_bytes = 0;
+    if (!io::try_read(fd, number_of_bytes, blobs...))
+      error::handle_file_exception();
+    return number_of_bytes;
+  }
+}    // namespace wlib::blob::io
+
+#endif
+
+#endif    // !WLIB_BLOB_IO_HPP_INCLUDED
@@ -0,0 +1,107 @@
+#pragma once
+#ifndef WLIB_BLOB_LZ_HPP_INCLUDED
+#define WLIB_BLOB_LZ_HPP_INCLUDED
+
+#include <wlib-BLOB.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+
+// Byte oriented LZ77 compression in the LZ4 block format: [token][literals][offset][match length]
+// sequences with 16 bit offsets. Output is always bounded by the room given, a block that does not
+// fit fails instead of overflowing.
+namespace wlib::blob::lz
+{
+  inline constexpr std::size_t window_size    = 64 * 1024;
+  inline constexpr std::size_t max_block_size = 64 * 1024;    // per call in the streaming mode
+
+  [[nodiscard]] constexpr std::size_t max_compressed_size(std::size_t const& number_of_bytes) noexcept { return number_of_bytes + number_of_bytes / 255 + 16; }
+
+  // Return the bytes written, 0 if capacity was too small.
+  std::size_t compress(std::byte* dst, std::size_t const& capacity, std::byte const* src, std::size_t const& number_of_bytes) noexcept;
+  // Fails on malformed input or if the output would exceed capacity.
+  bool decompress(std::byte* dst, std::size_t const& capacity, std::byte const* src, std::size_t const& number_of_bytes, std::size_t& decompressed_number_of_bytes) noexcept;
+
+  template <typename Tblob> bool try_compress_back(Blob_Interface<Tblob>& dst, std::span<std::byte const> const& src) noexcept
+  {
+    std::size_t const number_of_bytes = lz::compress(dst.get_blob().data() + dst.get_number_of_used_bytes(), dst.get_number_of_free_bytes(), src.data(), src.size());
+    return (number_of_bytes != 0) && dst.try_adjust_position(static_cast<std::ptrdiff_t>(number_of_bytes));
+  }
+  template <typename Tblob> bool try_decompress_back(Blob_Interface<Tblob>& dst, std::span<std::byte const> const& src) noexcept
+  {
+    std::size_t number_of_bytes = 0;
+    if (!lz::decompress(dst.get_blob().data() + dst.get_number_of_used_bytes(), dst.get_number_of_free_bytes(), src.data(), src.size(), number_of_bytes))
+      return false;
+    return dst.try_adjust_position(static_cast<std::ptrdiff_t>(number_of_bytes));
+  }
+  template <typename Tblob> void compress_back(Blob_Interface<Tblob>& dst, std::span<std::byte const> const& src)
+  {
+    if (!lz::try_compress_back(dst, src))
+      return error::handle_insert_exception();
+  }
+  template <typename Tblob> void decompress_back(Blob_Interface<Tblob>& dst, std::span<std::byte const> const& src)
+  {
+    if (!lz::try_decompress_back(dst, src))
+      return error::handle_read_exception();
+  }
+
+  // Streaming mode: every call produces one independent block, but matches may reach back into
+  // the last window_size bytes of earlier calls. Blocks must be decoded in order by a StreamDecoder,
+  // the caller keeps track of the block boundaries (e.g. with a FrameBuilder).
+  class StreamEncoder
+  {
+  public:
+    StreamEncoder();
+
+    void reset() noexcept;
+    bool try_compress(std::byte* dst, std::size_t const& capacity, std::span<std::byte const> const& src, std::size_t& number_of_bytes) noexcept;
+
+    template <typename Tblob> bool try_compress_back(Blob_Interface<Tblob>& dst, std::span<std::byte const> const& src) noexcept
+    {
+      std::size_t number_of_bytes = 0;
+      if (!this->try_compress(dst.get_blob().data() + dst.get_number_of_used_bytes(), dst.get_number_of_free_bytes(), src, number_of_bytes))
+        return false;
+      return dst.try_adjust_position(static_cast<std::ptrdiff_t>(number_of_bytes));
+    }
+    template <typename Tblob> void compress_back(Blob_Interface<Tblob>& dst, std::span<std::byte const> const& src)
+    {
+      if (!this->try_compress_back(dst, src))
+        return error::handle_insert_exception();
+    }
+
+  private:
+    std::unique_ptr<std::byte[]>     m_history;
+    std::unique_ptr<std::uint32_t[]> m_table;
+    std::size_t                      m_pos = 0;
+  };
+
+  class StreamDecoder
+  {
+  public:
+    StreamDecoder();
+
+    void reset() noexcept { this->m_pos = 0; }
+    bool try_decompress(std::byte* dst, std::size_t const& capacity, std::span<std::byte const> const& src, std::size_t& number_of_bytes) noexcept;
+
+    template <typename Tblob> bool try_decompress_back(Blob_Interface<Tblob>& dst, std::span<std::byte const> const& src) noexcept
+    {
+      std::size_t number_of_bytes = 0;
+      if (!this->try_decompress(dst.get_blob().data() + dst.get_number_of_used_bytes(), dst.get_number_of_free_bytes(), src, number_of_bytes))
+        return false;
+      return dst.try_adjust_position(static_cast<std::ptrdiff_t>(number_of_bytes));
+    }
+    template <typename Tblob> void decompress_back(Blob_Interface<Tblob>& dst, std::span<std::byte const> const& src)
+    {
+      if (!this->try_decompress_back(dst, src))
+        return error::handle_read_exception();
+    }
+
+  private:
+    std::unique_ptr<std::byte[]> m_history;
+    std::size_t                  m_pos = 0;
+  };
+}    // namespace wlib::blob::lz
+
+#endif    // !WLIB_BLOB_LZ_HPP_INCLUDED
@@ -0,0 +1,236 @@
+#pragma once
+#ifndef WLIB_BLOB_LAYOUT_HPP_INCLUDED
+#define WLIB_BLOB_LAYOUT_HPP_INCLUDED
+
+#include <wlib-BLOB.hpp>
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace wlib::blob
+{
+  template <std::size_t N> struct FieldName
+  {
+    constexpr FieldName(char const (&str)[N]) noexcept
+    {
+      for (std::size_t idx = 0; idx < N; idx++)
+        this->value[idx] = str[idx];
+    }
+
+    template <std::size_t M> [[nodiscard]] constexpr bool operator==(FieldName<M> const& other) const noexcept
+    {
+      if constexpr (N != M)
+      {
+        return false;
+      }
+      else
+      {
+        for (std::size_t idx = 0; idx < N; idx++)
+        {
+          if (this->value[idx] != other.value[idx])
+            return false;
+        }
+        return true;
+      }
+    }
+
+    char value[N]{};
+  };
+
+  // scalar field
+  template <FieldName name, ArithmeticOrByte T, std::endian endian = std::endian::native> struct Field
+  {
+    using value_type                          = T;
+    static constexpr auto        field_name   = name;
+    static constexpr bool        is_fixed     = true;
+    static constexpr std::size_t fixed_size   = sizeof(T);
+    static constexpr std::endian field_endian = endian;
+  };
+
+  // fixed number of raw bytes
+  template <FieldName name, std::size_t N> struct BytesField
+  {
+    static constexpr auto        field_name = name;
+    static constexpr bool        is_fixed   = true;
+    static constexpr std::size_t fixed_size = N;
+  };
+
+  // raw bytes preceded by their length
+  template <FieldName name, std::unsigned_integral Tlength, std::endian endian = std::endian::native> struct PrefixedField
+  {
+    using length_type                         = Tlength;
+    static constexpr auto        field_name   = name;
+    static constexpr bool        is_fixed     = false;
+    static constexpr std::size_t fixed_size   = sizeof(Tlength);
+    static constexpr std::endian field_endian = endian;
+  };
+
+  template <typename... Tfields> struct MessageLayout
+  {
+    static constexpr std::size_t number_of_fields = sizeof...(Tfields);
+    static constexpr bool        is_fixed         = (Tfields::is_fixed && ...);
+    static constexpr std::size_t min_size         = (std::size_t(0) + ... + Tfields::fixed_size);
+    static constexpr std::size_t no_offset        = ~std::size_t(0);
+
+    // offsets of all fields which are only preceded by fixed size fields
+    static constexpr std::array<std::size_t, number_of_fields + 1> static_offsets = []() {
+      constexpr std::array<std::size_t, number_of_fields> sizes{ Tfields::fixed_size... };
+      constexpr std::array<bool, number_of_fields>        fixed{ Tfields::is_fixed... };
+
+      std::array<std::size_t, number_of_fields + 1> offsets{};
+      std::size_t                                   pos = 0;
+      for (std::size_t idx = 0; idx < number_of_fields; idx++)
+      {
+        offsets[idx] = pos;
+        pos          = ((pos == no_offset) || !fixed[idx]) ? no_offset : (pos + sizes[idx]);
+      }
+      offsets[number_of_fields] = pos;
+      return offsets;
+    }();
+
+    template <FieldName name> static constexpr std::size_t index_of = []() {
+      constexpr std::array<bool, number_of_fields> match{ (Tfields::field_name == name)... };
+      for (std::size_t idx = 0; idx < number_of_fields; idx++)
+      {
+        if (match[idx])
+          return idx;
+      }
+      return number_of_fields;
+    }();
+
+    template <std::size_t idx> using field_at = std::tuple_element_t<idx, std::tuple<Tfields...>>;
+    template <FieldName name> using field_t   = field_at<index_of<name>>;
+  };
+
+  // View of one message in a byte range. try_attach() checks the range and resolves all
+  // variable offsets once, the accessors do no further checks.
+  template <typename Tlayout, typename Tbyte = std::byte const> class MessageView
+  {
+    static_assert(std::is_same_v<std::remove_const_t<Tbyte>, std::byte>, "MessageView works on std::byte ranges");
+
+  public:
+    constexpr MessageView() noexcept = default;
+
+    [[nodiscard]] constexpr bool        is_attached() const noexcept { return this->m_data != nullptr; }
+    [[nodiscard]] constexpr std::size_t get_number_of_bytes() const noexcept { return this->offset(Tlayout::number_of_fields); }
+
+    constexpr bool try_attach(std::span<Tbyte> const& data) noexcept
+    {
+      this->m_data = nullptr;
+      if (data.size() < Tlayout::min_size)
+        return false;
+
+      if constexpr (!Tlayout::is_fixed)
+      {
+        std::size_t pos = 0;
+        bool        ret = true;
+        this->resolve_offsets(data, pos, ret, std::make_index_sequence<Tlayout::number_of_fields>{});
+        if (!ret)
+          return false;
+      }
+      this->m_data = data.data();
+      return true;
+    }
+
+    constexpr void attach(std::span<Tbyte> const& data)
+    {
+      if (!this->try_attach(data))
+        return error::handle_read_exception();
+    }
+
+    template <FieldName name> [[nodiscard]] constexpr auto get() const noexcept
+    {
+      constexpr std::size_t idx = Tlayout::template index_of<name>;
+      static_assert(idx < Tlayout::number_of_fields, "no field with this name");
+      using field_t = typename Tlayout::template field_t<name>;
+
+      Tbyte* const begin = &this->m_data[this->offset(idx)];
+      if constexpr (requires { typename field_t::value_type; })
+      {
+        return MessageView::load<typename field_t::value_type, field_t::field_endian>(begin);
+      }
+      else if constexpr (requires { typename field_t::length_type; })
+      {
+        return std::span<Tbyte>(begin + sizeof(typename field_t::length_type), this->offset(idx + 1) - this->offset(idx) - sizeof(typename field_t::length_type));
+      }
+      else
+      {
+        return std::span<Tbyte, field_t::fixed_size>(begin, field_t::fixed_size);
+      }
+    }
+
+    template <FieldName name, ArithmeticOrByte T>
+    requires(!std::is_const_v<Tbyte>) constexpr void set(T const& value) noexcept
+    {
+      constexpr std::size_t idx = Tlayout::template index_of<name>;
+      static_assert(idx < Tlayout::number_of_fields, "no field with this name");
+      using field_t = typename Tlayout::template field_t<name>;
+      static_assert(requires { typename field_t::value_type; }, "only scalar fields can be set");
+
+      MessageView::store<typename field_t::value_type, field_t::field_endian>(&this->m_data[this->offset(idx)], static_cast<typename field_t::value_type>(value));
+    }
+
+  private:
+    [[nodiscard]] constexpr std::size_t offset(std::size_t const& idx) const noexcept
+    {
+      if constexpr (Tlayout::is_fixed)
+        return Tlayout::static_offsets[idx];
+      else
+        return (Tlayout::static_offsets[idx] != Tlayout::no_offset) ? Tlayout::static_offsets[idx] : this->m_offsets[idx];
+    }
+
+    template <std::size_t... idx> constexpr void resolve_offsets(std::span<Tbyte> const& data, std::size_t& pos, bool& ret, std::index_sequence<idx...>) noexcept
+    {
+      ((ret = ret && this->resolve_offset<idx>(data, pos)), ...);
+      this->m_offsets[Tlayout::number_of_fields] = pos;
+    }
+
+    template <std::size_t idx> constexpr bool resolve_offset(std::span<Tbyte> const& data, std::size_t& pos) noexcept
+    {
+      using field_t = typename Tlayout::template field_at<idx>;
+
+      this->m_offsets[idx]   = pos;
+      std::size_t field_size = field_t::fixed_size;
+      if ((data.size() - pos) < field_size)
+        return false;
+      if constexpr (!field_t::is_fixed)
+      {
+        // Compared before adding, a 64 bit prefix would wrap field_size otherwise.
+        auto const length = MessageView::load<typename field_t::length_type, field_t::field_endian>(&data[pos]);
+        if (static_cast<std::uint64_t>(length) > static_cast<std::uint64_t>(data.size() - pos - field_size))
+          return false;
+        field_size += static_cast<std::size_t>(length);
+      }
+      pos += field_size;
+      return true;
+    }
+
+    template <ArithmeticOrByte T, std::endian endian> static constexpr T load(std::byte const* src) noexcept
+    {
+      std::array<std::byte, sizeof(T)> raw;
+      for (std::size_t idx = 0; idx < sizeof(T); idx++)
+        raw[idx] = src[idx];
+      T const value = std::bit_cast<T>(raw);
+      return (endian == std::endian::native) ? value : wlib::blob::byteswap(value);
+    }
+
+    template <ArithmeticOrByte T, std::endian endian> static constexpr void store(std::byte* dst, T const& value) noexcept
+    {
+      std::array<std::byte, sizeof(T)> const raw = std::bit_cast<std::array<std::byte, sizeof(T)>>((endian == std::endian::native) ? value : wlib::blob::byteswap(value));
+      for (std::size_t idx = 0; idx < sizeof(T); idx++)
+        dst[idx] = raw[idx];
+    }
+
+    Tbyte*                                                 m_data = nullptr;
+    std::array<std::size_t, Tlayout::number_of_fields + 1> m_offsets{};
+  };
+}    // namespace wlib::blob
+
+#endif    // !WLIB_BLOB_LAYOUT_HPP_INCLUDED
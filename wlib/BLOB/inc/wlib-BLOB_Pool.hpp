@@ -0,0 +1,131 @@
+#pragma once
+#ifndef WLIB_BLOB_POOL_HPP_INCLUDED
+#define WLIB_BLOB_POOL_HPP_INCLUDED
+
+#include <wlib-BLOB.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+namespace wlib::blob
+{
+  class BlobPool;
+
+  struct pool_statistics
+  {
+    std::size_t capacity              = 0;
+    std::size_t in_use                = 0;
+    std::size_t high_water_mark       = 0;    // most buffers in use at the same time, misses included
+    std::size_t acquisitions          = 0;
+    std::size_t misses                = 0;    // acquisitions served from the heap because the pool was empty
+    std::size_t cross_thread_releases = 0;    // buffers released by another thread than the acquiring one
+  };
+
+  // MemoryBlob on a pool buffer, the buffer goes back to its pool on destruction.
+  // A handle must not outlive the pool it was acquired from.
+  class PooledBlob: public MemoryBlob
+  {
+  public:
+    PooledBlob() noexcept
+        : MemoryBlob(nullptr, std::size_t(0))
+    {
+    }
+    PooledBlob(PooledBlob const&)            = delete;
+    PooledBlob& operator=(PooledBlob const&) = delete;
+    PooledBlob(PooledBlob&& other) noexcept;
+    PooledBlob& operator=(PooledBlob&& other) noexcept;
+    ~PooledBlob() { this->release(); }
+
+    [[nodiscard]] bool is_valid() const noexcept { return this->m_pool != nullptr; }
+    [[nodiscard]] bool is_pooled() const noexcept { return this->m_pool != nullptr && this->m_slot != no_slot; }
+    void               release() noexcept;
+
+  private:
+    friend class BlobPool;
+
+    static constexpr std::uint32_t no_slot = UINT32_MAX;
+
+    PooledBlob(BlobPool* pool, std::byte* buffer, std::size_t const& size, std::uint32_t slot) noexcept
+        : MemoryBlob(buffer, size)
+        , m_pool(pool)
+        , m_buffer(buffer)
+        , m_slot(slot)
+        , m_owner(std::this_thread::get_id())
+    {
+    }
+
+    BlobPool*       m_pool   = nullptr;
+    std::byte*      m_buffer = nullptr;
+    std::uint32_t   m_slot   = no_slot;
+    std::thread::id m_owner;
+  };
+
+  // Fixed number of equally sized buffers in one cache line aligned slab. The free list is a
+  // lock-free stack, so acquire and release may be called from any thread. The counters behind
+  // get_statistics() are spread over cache line sized shards picked per thread.
+  class BlobPool
+  {
+  public:
+    static constexpr std::size_t alignment = 64;
+
+    // More than UINT32_MAX - 1 buffers go to error::handle_insert_exception(), if that returns the pool
+    // has no buffers and acquire() always falls back to the heap.
+    BlobPool(std::size_t const& buffer_size, std::size_t const& number_of_buffers);
+    BlobPool(BlobPool const&)            = delete;
+    BlobPool& operator=(BlobPool const&) = delete;
+
+    [[nodiscard]] std::size_t     get_buffer_size() const noexcept { return this->m_buffer_size; }
+    [[nodiscard]] std::size_t     get_number_of_buffers() const noexcept { return this->m_number_of_buffers; }
+    [[nodiscard]] pool_statistics get_statistics() const noexcept;
+
+    // Fails if all buffers are in use.
+    bool try_acquire(PooledBlob& blob) noexcept;
+    // Falls back to a heap buffer of the same size if all buffers are in use.
+    [[nodiscard]] PooledBlob acquire();
+
+  private:
+    friend class PooledBlob;
+
+    static constexpr std::size_t number_of_shards = 16;
+
+    struct slab_deleter
+    {
+      void operator()(std::byte* slab) const noexcept { ::operator delete[](slab, std::align_val_t(alignment)); }
+    };
+
+    struct alignas(alignment) counter_shard
+    {
+      std::atomic<std::size_t> acquisitions{ 0 };
+      std::atomic<std::size_t> releases{ 0 };
+      std::atomic<std::size_t> cross_thread_releases{ 0 };
+    };
+
+    bool           try_pop(std::uint32_t& slot) noexcept;
+    void           push(std::uint32_t const& slot) noexcept;
+    counter_shard& get_shard() noexcept;
+    void           release(PooledBlob& blob) noexcept;
+
+    std::size_t                                   m_buffer_size;
+    std::size_t                                   m_stride;
+    std::size_t                                   m_number_of_buffers;
+    std::unique_ptr<std::byte[], slab_deleter>    m_slab;
+    std::unique_ptr<std::atomic<std::uint32_t>[]> m_next;
+
+    alignas(alignment) std::atomic<std::uint64_t> m_head;    // slot index in the low, ABA tag in the high half
+
+    // The stack hands out released slots before untouched ones, so the number of slots ever used is
+    // the peak of pool buffers in use. Heap buffers are only needed while the pool is empty.
+    alignas(alignment) std::atomic<std::size_t> m_touched{ 0 };
+    std::atomic<std::size_t> m_misses{ 0 };
+    std::atomic<std::size_t> m_heap_in_use{ 0 };
+    std::atomic<std::size_t> m_heap_high_water_mark{ 0 };
+
+    std::array<counter_shard, number_of_shards> m_shards;
+  };
+}    // namespace wlib::blob
+
+#endif    // !WLIB_BLOB_POOL_HPP_INCLUDED
@@ -0,0 +1,174 @@
+#pragma once
+#ifndef WLIB_BLOB_RING_HPP_INCLUDED
+#define WLIB_BLOB_RING_HPP_INCLUDED
+
+#include <wlib-BLOB.hpp>
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <span>
+
+namespace wlib::blob
+{
+  // Byte ring for exactly one producer and one consumer thread. Both sides are wait-free, the
+  // consumer reads contiguous regions in place and commits them afterwards.
+  class ByteRing
+  {
+  public:
+    static constexpr std::size_t cache_line_size = 64;
+
+    // The capacity is rounded up to the next power of two.
+    explicit ByteRing(std::size_t const& capacity)
+        : m_capacity(std::bit_ceil(capacity < 2 ? std::size_t(2) : capacity))
+        , m_mask(m_capacity - 1)
+        , m_data(std::make_unique<std::byte[]>(m_capacity))
+    {
+    }
+    ByteRing(ByteRing const&)            = delete;
+    ByteRing& operator=(ByteRing const&) = delete;
+
+    [[nodiscard]] std::size_t get_total_number_of_bytes() const noexcept { return this->m_capacity; }
+    // Exact on the calling side, the other side may have moved on already.
+    [[nodiscard]] std::size_t get_number_of_used_bytes() const noexcept
+    {
+      return this->m_write.load(std::memory_order_acquire) - this->m_read.load(std::memory_order_acquire);
+    }
+
+    // Producer
+    [[nodiscard]] std::size_t get_number_of_free_bytes() noexcept
+    {
+      this->m_read_cache = this->m_read.load(std::memory_order_acquire);
+      return this->m_capacity - (this->m_write.load(std::memory_order_relaxed) - this->m_read_cache);
+    }
+    // Contiguous free region, fill it and call commit_write().
+    [[nodiscard]] std::span<std::byte> get_writable_region() noexcept
+    {
+      std::size_t const write = this->m_write.load(std::memory_order_relaxed);
+      std::size_t const free  = this->get_number_of_free_bytes();
+      std::size_t const idx   = write & this->m_mask;
+      return { this->m_data.get() + idx, (free < (this->m_capacity - idx)) ? free : (this->m_capacity - idx) };
+    }
+    void commit_write(std::size_t const& number_of_bytes) noexcept
+    {
+      this->m_write.store(this->m_write.load(std::memory_order_relaxed) + number_of_bytes, std::memory_order_release);
+    }
+
+    bool try_insert_back(std::byte const* begin, std::size_t const& number_of_bytes) noexcept
+    {
+      std::size_t const write = this->m_write.load(std::memory_order_relaxed);
+      if ((this->m_capacity - (write - this->m_read_cache)) < number_of_bytes)
+      {
+        this->m_read_cache = this->m_read.load(std::memory_order_acquire);
+        if ((this->m_capacity - (write - this->m_read_cache)) < number_of_bytes)
+          return false;
+      }
+      this->copy_in(write & this->m_mask, begin, number_of_bytes);
+      this->m_write.store(write + number_of_bytes, std::memory_order_release);
+      return true;
+    }
+    bool try_insert_back(std::byte const& byte) noexcept { return this->try_insert_back(&byte, 1); }
+    bool try_insert_back(std::span<std::byte const> const& data) noexcept { return this->try_insert_back(data.data(), data.size()); }
+    template <ArithmeticOrByte T> bool try_insert_back(T const& value, std::endian endian = std::endian::native) noexcept
+    {
+      T const tmp = (endian == std::endian::native) ? value : wlib::blob::byteswap(value);
+      return this->try_insert_back(reinterpret_cast<std::byte const*>(&tmp), sizeof(T));
+    }
+    template <ArithmeticOrByte T, std::endian endian> bool try_insert_back(T const& value) noexcept
+    {
+      T const tmp = (endian == std::endian::native) ? value : wlib::blob::byteswap(value);
+      return this->try_insert_back(reinterpret_cast<std::byte const*>(&tmp), sizeof(T));
+    }
+
+    void insert_back(std::byte const* begin, std::size_t const& number_of_bytes)
+    {
+      if (!this->try_insert_back(begin, number_of_bytes))
+        return error::handle_insert_exception();
+    }
+    void insert_back(std::span<std::byte const> const& data) { this->insert_back(data.data(), data.size()); }
+    template <ArithmeticOrByte T> void insert_back(T const& value, std::endian endian = std::endian::native)
+    {
+      if (!this->try_insert_back(value, endian))
+        return error::handle_insert_exception();
+    }
+
+    // Consumer
+    // Contiguous readable region, a wrapped payload needs two calls.
+    [[nodiscard]] std::span<std::byte const> get_readable_region() noexcept
+    {
+      std::size_t const read = this->m_read.load(std::memory_order_relaxed);
+      if (this->m_write_cache == read)
+        this->m_write_cache = this->m_write.load(std::memory_order_acquire);
+      std::size_t const used = this->m_write_cache - read;
+      std::size_t const idx  = read & this->m_mask;
+      return { this->m_data.get() + idx, (used < (this->m_capacity - idx)) ? used : (this->m_capacity - idx) };
+    }
+    void commit_read(std::size_t const& number_of_bytes) noexcept
+    {
+      this->m_read.store(this->m_read.load(std::memory_order_relaxed) + number_of_bytes, std::memory_order_release);
+    }
+
+    bool try_extract_front(std::byte* dst, std::size_t const& number_of_bytes) noexcept
+    {
+      std::size_t const read = this->m_read.load(std::memory_order_relaxed);
+      if ((this->m_write_cache - read) < number_of_bytes)
+      {
+        this->m_write_cache = this->m_write.load(std::memory_order_acquire);
+        if ((this->m_write_cache - read) < number_of_bytes)
+          return false;
+      }
+      this->copy_out(dst, read & this->m_mask, number_of_bytes);
+      this->m_read.store(read + number_of_bytes, std::memory_order_release);
+      return true;
+    }
+    template <ArithmeticOrByte T> bool try_extract_front(T& value, std::endian endian = std::endian::native) noexcept
+    {
+      if (!this->try_extract_front(reinterpret_cast<std::byte*>(&value), sizeof(T)))
+        return false;
+      if (endian != std::endian::native)
+        value = wlib::blob::byteswap(value);
+      return true;
+    }
+    template <ArithmeticOrByte T> [[nodiscard]] T extract_front(std::endian endian = std::endian::native)
+    {
+      T value{};
+      if (!this->try_extract_front(value, endian))
+        error::handle_remove_exception();
+      return value;
+    }
+
+  private:
+    void copy_in(std::size_t const& idx, std::byte const* src, std::size_t const& number_of_bytes) noexcept
+    {
+      std::size_t const first = (number_of_bytes < (this->m_capacity - idx)) ? number_of_bytes : (this->m_capacity - idx);
+      if (first != 0)
+        std::memcpy(this->m_data.get() + idx, src, first);
+      if (first != number_of_bytes)
+        std::memcpy(this->m_data.get(), src + first, number_of_bytes - first);
+    }
+    void copy_out(std::byte* dst, std::size_t const& idx, std::size_t const& number_of_bytes) const noexcept
+    {
+      std::size_t const first = (number_of_bytes < (this->m_capacity - idx)) ? number_of_bytes : (this->m_capacity - idx);
+      if (first != 0)
+        std::memcpy(dst, this->m_data.get() + idx, first);
+      if (first != number_of_bytes)
+        std::memcpy(dst + first, this->m_data.get(), number_of_bytes - first);
+    }
+
+    std::size_t const            m_capacity;
+    std::size_t const            m_mask;
+    std::unique_ptr<std::byte[]> m_data;
+
+    // Written by the producer, the cached read index saves a shared cache line access per insert.
+    alignas(cache_line_size) std::atomic<std::size_t> m_write{ 0 };
+    std::size_t m_read_cache = 0;
+
+    // Written by the consumer.
+    alignas(cache_line_size) std::atomic<std::size_t> m_read{ 0 };
+    std::size_t m_write_cache = 0;
+  };
+}    // namespace wlib::blob
+
+#endif    // !WLIB_BLOB_RING_HPP_INCLUDED
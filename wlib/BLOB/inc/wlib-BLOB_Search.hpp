@@ -0,0 +1,54 @@
+#pragma once
+#ifndef WLIB_BLOB_SEARCH_HPP_INCLUDED
+#define WLIB_BLOB_SEARCH_HPP_INCLUDED
+
+#include <wlib-BLOB.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace wlib::blob
+{
+  inline constexpr std::size_t npos = SIZE_MAX;
+
+  // Span primitives, vectorized with AVX2 or SSE2 where available. All return the index of the
+  // first match or npos.
+  [[nodiscard]] std::size_t find(std::span<std::byte const> const& data, std::byte const& value) noexcept;
+  [[nodiscard]] std::size_t find_any_of(std::span<std::byte const> const& data, std::span<std::byte const> const& set) noexcept;
+  [[nodiscard]] std::size_t find(std::span<std::byte const> const& data, std::span<std::byte const> const& pattern) noexcept;
+  [[nodiscard]] std::size_t count(std::span<std::byte const> const& data, std::byte const& value) noexcept;
+
+  // Blob variants search the used bytes from offset on, the result is relative to the blob.
+  template <typename Tblob> [[nodiscard]] std::size_t find(Blob_Interface<Tblob> const& blob, std::byte const& value, std::size_t const& offset = 0) noexcept
+  {
+    if (blob.get_number_of_used_bytes() < offset)
+      return npos;
+    std::size_t const idx = wlib::blob::find(blob.get_blob().subspan(offset), value);
+    return (idx == npos) ? npos : idx + offset;
+  }
+  template <typename Tblob>
+  [[nodiscard]] std::size_t find_any_of(Blob_Interface<Tblob> const& blob, std::span<std::byte const> const& set, std::size_t const& offset = 0) noexcept
+  {
+    if (blob.get_number_of_used_bytes() < offset)
+      return npos;
+    std::size_t const idx = wlib::blob::find_any_of(blob.get_blob().subspan(offset), set);
+    return (idx == npos) ? npos : idx + offset;
+  }
+  template <typename Tblob>
+  [[nodiscard]] std::size_t find(Blob_Interface<Tblob> const& blob, std::span<std::byte const> const& pattern, std::size_t const& offset = 0) noexcept
+  {
+    if (blob.get_number_of_used_bytes() < offset)
+      return npos;
+    std::size_t const idx = wlib::blob::find(blob.get_blob().subspan(offset), pattern);
+    return (idx == npos) ? npos : idx + offset;
+  }
+  template <typename Tblob> [[nodiscard]] std::size_t count(Blob_Interface<Tblob> const& blob, std::byte const& value, std::size_t const& offset = 0) noexcept
+  {
+    if (blob.get_number_of_used_bytes() < offset)
+      return 0;
+    return wlib::blob::count(blob.get_blob().subspan(offset), value);
+  }
+}    // namespace wlib::blob
+
+#endif    // !WLIB_BLOB_SEARCH_HPP_INCLUDED
@@ -0,0 +1,473 @@
+#pragma once
+#ifndef WLIB_BLOB_SEGMENTED_HPP_INCLUDED
+#define WLIB_BLOB_SEGMENTED_HPP_INCLUDED
+
+#include <wlib-BLOB.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <span>
+
+namespace wlib::blob
+{
+  // Rope of byte segments. External payloads are referenced instead of copied, small
+  // owned data lives in the inline head (grows towards the front) and tail buffers.
+  // The segments are a fixed array without heap use: appending is O(1), inserting at any other
+  // offset locates and shifts segments in O(segments), and at most max_segments spans fit.
+  // Removed head and tail bytes are reused once nothing before (head) or after (tail) them is still
+  // referenced, holes in the middle of a buffer stay unused until clear(). Removing bytes inside a
+  // segment splits it; with a full segment table the rest of that segment is copied into the tail or
+  // head buffer instead, and the removal fails only if it fits in neither.
+  template <std::size_t max_segments, std::size_t head_size = 32, std::size_t tail_size = 32> class SegmentedBlob
+  {
+  public:
+    using segment_t = std::span<std::byte const>;
+
+    constexpr SegmentedBlob() noexcept             = default;
+    SegmentedBlob(SegmentedBlob const&)            = delete;
+    SegmentedBlob(SegmentedBlob&&)                 = delete;
+    SegmentedBlob& operator=(SegmentedBlob const&) = delete;
+    SegmentedBlob& operator=(SegmentedBlob&&)      = delete;
+
+    [[nodiscard]] constexpr std::size_t                get_number_of_used_bytes() const noexcept { return this->m_used; }
+    [[nodiscard]] constexpr std::size_t                get_number_of_segments() const noexcept { return this->m_count; }
+    [[nodiscard]] constexpr std::size_t                get_number_of_free_segments() const noexcept { return max_segments - this->m_count; }
+    [[nodiscard]] constexpr std::size_t                get_number_of_free_head_bytes() const noexcept { return this->m_head_idx; }
+    [[nodiscard]] constexpr std::size_t                get_number_of_free_tail_bytes() const noexcept { return tail_size - this->m_tail_idx; }
+    [[nodiscard]] constexpr std::span<segment_t const> get_segments() const noexcept { return { this->m_segments.data(), this->m_count }; }
+    constexpr void                                     clear() noexcept
+    {
+      this->m_count    = 0;
+      this->m_used     = 0;
+      this->m_head_idx = head_size;
+      this->m_tail_idx = 0;
+    }
+
+    bool try_reference(std::size_t const& offset, segment_t const& data) noexcept
+    {
+      if (this->m_used < offset)
+        return false;
+      if (data.empty())
+        return true;
+      return this->try_insert_segment(offset, data);
+    }
+    bool try_reference_back(segment_t const& data) noexcept { return this->try_reference(this->m_used, data); }
+    bool try_reference_front(segment_t const& data) noexcept { return this->try_reference(0, data); }
+
+    bool try_insert(std::size_t const& offset, std::byte const* begin, std::size_t const& number_of_bytes) noexcept
+    {
+      return this->try_insert_owned(offset, begin, number_of_bytes, false);
+    }
+    bool try_insert_reverse(std::size_t const& offset, std::byte const* begin, std::size_t const& number_of_bytes) noexcept
+    {
+      return this->try_insert_owned(offset, begin, number_of_bytes, true);
+    }
+
+    bool try_insert(std::size_t const& offset, std::byte const& byte) noexcept { return this->try_insert(offset, &byte, 1); }
+    bool try_insert(std::size_t const& offset, std::span<std::byte const> const& data) noexcept
+    {
+      return this->try_insert(offset, data.data(), data.size_bytes());
+    }
+    bool try_insert_back(std::byte const& byte) noexcept { return this->try_insert(this->m_used, &byte, 1); }
+    bool try_insert_back(std::byte const* begin, std::size_t const& number_of_bytes) noexcept { return this->try_insert(this->m_used, begin, number_of_bytes); }
+    bool try_insert_back(std::span<std::byte const> const& data) noexcept { return this->try_insert(this->m_used, data); }
+    bool try_insert_front(std::byte const& byte) noexcept { return this->try_insert(0, &byte, 1); }
+    bool try_insert_front(std::byte const* begin, std::size_t const& number_of_bytes) noexcept { return this->try_insert(0, begin, number_of_bytes); }
+    bool try_insert_front(std::span<std::byte const> const& data) noexcept { return this->try_insert(0, data); }
+
+    template <ArithmeticOrByte T> bool try_insert(std::size_t const& offset, T const& value, std::endian endian = std::endian::native) noexcept
+    {
+      return this->try_insert_owned(offset, reinterpret_cast<std::byte const*>(&value), sizeof(T), endian != std::endian::native);
+    }
+    template <ArithmeticOrByte T> bool try_insert_back(T const& value, std::endian endian = std::endian::native) noexcept
+    {
+      return this->try_insert(this->m_used, value, endian);
+    }
+    template <ArithmeticOrByte T> bool try_insert_front(T const& value, std::endian endian = std::endian::native) noexcept
+    {
+      return this->try_insert(0, value, endian);
+    }
+
+    bool try_read(std::size_t const& offset, std::byte* ptr, std::size_t const& number_of_bytes) const noexcept
+    {
+      if (this->m_used < (offset + number_of_bytes))
+        return false;
+      this->gather(offset, ptr, number_of_bytes, false);
+      return true;
+    }
+    bool try_read_reverse(std::size_t const& offset, std::byte* ptr, std::size_t const& number_of_bytes) const noexcept
+    {
+      if (this->m_used < (offset + number_of_bytes))
+        return false;
+      this->gather(offset, ptr, number_of_bytes, true);
+      return true;
+    }
+
+    template <ArithmeticOrByte T> bool try_read(std::size_t const& offset, T& value, std::endian endian = std::endian::native) const noexcept
+    {
+      if (endian == std::endian::native)
+        return this->try_read(offset, reinterpret_cast<std::byte*>(&value), sizeof(T));
+      else
+        return this->try_read_reverse(offset, reinterpret_cast<std::byte*>(&value), sizeof(T));
+    }
+    template <ArithmeticOrByte T> bool try_read_back(T& value, std::endian endian = std::endian::native) const noexcept
+    {
+      if (this->m_used < sizeof(T))
+        return false;
+      return this->try_read(this->m_used - sizeof(T), value, endian);
+    }
+    template <ArithmeticOrByte T> bool try_read_front(T& value, std::endian endian = std::endian::native) const noexcept
+    {
+      return this->try_read(0, value, endian);
+    }
+
+    bool try_remove(std::size_t const& offset, std::size_t const& number_of_bytes = 1) noexcept
+    {
+      if (this->m_used < (offset + number_of_bytes))
+        return false;
+      if (number_of_bytes == 0)
+        return true;
+
+      std::size_t idx   = 0;
+      std::size_t inner = 0;
+      this->locate(offset, idx, inner);
+
+      segment_t const   seg = this->m_segments[idx];
+      std::size_t const end = inner + number_of_bytes;
+      if ((inner != 0) && (end < seg.size()))
+      {
+        if (this->m_count == max_segments)
+          return this->try_remove_without_split(idx, inner, end);
+        this->shift_segments_right(idx + 1, 1);
+        this->m_segments[idx]     = seg.first(inner);
+        this->m_segments[idx + 1] = seg.subspan(end);
+        this->m_used -= number_of_bytes;
+        return true;
+      }
+
+      std::size_t left = number_of_bytes;
+      if (inner != 0)
+      {
+        left -= seg.size() - inner;
+        this->m_segments[idx] = seg.first(inner);
+        idx++;
+      }
+
+      std::size_t first_dropped = idx;
+      while (left != 0 && left >= this->m_segments[idx].size())
+      {
+        left -= this->m_segments[idx].size();
+        idx++;
+      }
+      if (left != 0)
+        this->m_segments[idx] = this->m_segments[idx].subspan(left);
+
+      this->shift_segments_left(idx, idx - first_dropped);
+      this->m_used -= number_of_bytes;
+      if (this->m_count == 0)
+        this->clear();
+      else
+        this->reclaim_buffers();
+      return true;
+    }
+    bool try_remove_back(std::size_t const& number_of_bytes = 1) noexcept
+    {
+      if (this->m_used < number_of_bytes)
+        return false;
+      return this->try_remove(this->m_used - number_of_bytes, number_of_bytes);
+    }
+    bool try_remove_front(std::size_t const& number_of_bytes = 1) noexcept { return this->try_remove(0, number_of_bytes); }
+
+    void reference(std::size_t const& offset, segment_t const& data)
+    {
+      if (!this->try_reference(offset, data))
+        return error::handle_insert_exception();
+    }
+    void reference_back(segment_t const& data) { return this->reference(this->m_used, data); }
+    void reference_front(segment_t const& data) { return this->reference(0, data); }
+
+    void insert(std::size_t const& offset, std::byte const* begin, std::size_t const& number_of_bytes)
+    {
+      if (!this->try_insert(offset, begin, number_of_bytes))
+        return error::handle_insert_exception();
+    }
+    void insert_back(std::byte const* begin, std::size_t const& number_of_bytes) { return this->insert(this->m_used, begin, number_of_bytes); }
+    void insert_front(std::byte const* begin, std::size_t const& number_of_bytes) { return this->insert(0, begin, number_of_bytes); }
+
+    template <ArithmeticOrByte T> void insert(std::size_t const& offset, T const& value, std::endian endian = std::endian::native)
+    {
+      if (!this->try_insert(offset, value, endian))
+        return error::handle_insert_exception();
+    }
+    template <ArithmeticOrByte T> void insert_back(T const& value, std::endian endian = std::endian::native)
+    {
+      return this->insert(this->m_used, value, endian);
+    }
+    template <ArithmeticOrByte T> void insert_front(T const& value, std::endian endian = std::endian::native) { return this->insert(0, value, endian); }
+
+    void remove(std::size_t const& offset, std::size_t const& number_of_bytes = 1)
+    {
+      if (!this->try_remove(offset, number_of_bytes))
+        return error::handle_remove_exception();
+    }
+    void remove_back(std::size_t const& number_of_bytes = 1)
+    {
+      if (!this->try_remove_back(number_of_bytes))
+        return error::handle_remove_exception();
+    }
+    void remove_front(std::size_t const& number_of_bytes = 1) { return this->remove(0, number_of_bytes); }
+
+    template <ArithmeticOrByte T> [[nodiscard]] T read(std::size_t const& offset, std::endian endian = std::endian::native) const
+    {
+      T ret{};
+      if (!this->try_read(offset, ret, endian))
+        error::handle_read_exception();
+      return ret;
+    }
+    template <ArithmeticOrByte T> [[nodiscard]] T read_back(std::endian endian = std::endian::native) const
+    {
+      T ret{};
+      if (!this->try_read_back(ret, endian))
+        error::handle_read_exception();
+      return ret;
+    }
+    template <ArithmeticOrByte T> [[nodiscard]] T read_front(std::endian endian = std::endian::native) const
+    {
+      T ret{};
+      if (!this->try_read_front(ret, endian))
+        error::handle_read_exception();
+      return ret;
+    }
+
+  private:
+    bool try_insert_owned(std::size_t const& offset, std::byte const* begin, std::size_t const& number_of_bytes, bool reverse) noexcept
+    {
+      if (this->m_used < offset)
+        return false;
+      if (number_of_bytes == 0)
+        return true;
+
+      if (offset == 0 && this->m_count != 0 && this->m_head_idx < head_size && this->m_segments[0].data() == this->m_head.data() + this->m_head_idx &&
+          number_of_bytes <= this->m_head_idx)
+      {
+        this->m_head_idx -= number_of_bytes;
+        SegmentedBlob::copy(this->m_head.data() + this->m_head_idx, begin, number_of_bytes, reverse);
+        this->m_segments[0] = segment_t(this->m_head.data() + this->m_head_idx, this->m_segments[0].size() + number_of_bytes);
+        this->m_used += number_of_bytes;
+        return true;
+      }
+
+      if (offset == this->m_used && this->m_count != 0 && this->m_tail_idx != 0 &&
+          (this->m_segments[this->m_count - 1].data() + this->m_segments[this->m_count - 1].size()) == this->m_tail.data() + this->m_tail_idx &&
+          number_of_bytes <= (tail_size - this->m_tail_idx))
+      {
+        SegmentedBlob::copy(this->m_tail.data() + this->m_tail_idx, begin, number_of_bytes, reverse);
+        segment_t const& last               = this->m_segments[this->m_count - 1];
+        this->m_segments[this->m_count - 1] = segment_t(last.data(), last.size() + number_of_bytes);
+        this->m_tail_idx += number_of_bytes;
+        this->m_used += number_of_bytes;
+        return true;
+      }
+
+      if (this->m_count + this->segments_needed(offset) > max_segments)
+        return false;
+
+      std::byte* dst = nullptr;
+      if (offset == 0 && this->m_used != 0 && number_of_bytes <= this->m_head_idx)
+      {
+        this->m_head_idx -= number_of_bytes;
+        dst = this->m_head.data() + this->m_head_idx;
+      }
+      else if (number_of_bytes <= (tail_size - this->m_tail_idx))
+      {
+        dst = this->m_tail.data() + this->m_tail_idx;
+        this->m_tail_idx += number_of_bytes;
+      }
+      else if (number_of_bytes <= this->m_head_idx)
+      {
+        this->m_head_idx -= number_of_bytes;
+        dst = this->m_head.data() + this->m_head_idx;
+      }
+      else
+      {
+        return false;
+      }
+
+      SegmentedBlob::copy(dst, begin, number_of_bytes, reverse);
+      return this->try_insert_segment(offset, segment_t(dst, number_of_bytes));
+    }
+
+    bool try_insert_segment(std::size_t const& offset, segment_t const& data) noexcept
+    {
+      if (offset == this->m_used)
+      {
+        if (this->m_count == max_segments)
+          return false;
+        this->m_segments[this->m_count++] = data;
+        this->m_used += data.size();
+        return true;
+      }
+      if (this->m_count + this->segments_needed(offset) > max_segments)
+        return false;
+
+      std::size_t idx   = 0;
+      std::size_t inner = 0;
+      this->locate(offset, idx, inner);
+
+      if (inner == 0)
+      {
+        this->shift_segments_right(idx, 1);
+        this->m_segments[idx] = data;
+      }
+      else
+      {
+        segment_t const seg = this->m_segments[idx];
+        this->shift_segments_right(idx + 1, 2);
+        this->m_segments[idx]     = seg.first(inner);
+        this->m_segments[idx + 1] = data;
+        this->m_segments[idx + 2] = seg.subspan(inner);
+      }
+      this->m_used += data.size();
+      return true;
+    }
+
+    // Drops [inner, end) from segment idx by copying the bytes around it into one owned segment.
+    bool try_remove_without_split(std::size_t const& idx, std::size_t const& inner, std::size_t const& end) noexcept
+    {
+      segment_t const   seg  = this->m_segments[idx];
+      std::size_t const size = seg.size() - (end - inner);
+
+      std::byte* dst = nullptr;
+      if (size <= (tail_size - this->m_tail_idx))
+      {
+        dst = this->m_tail.data() + this->m_tail_idx;
+        this->m_tail_idx += size;
+      }
+      else if (size <= this->m_head_idx)
+      {
+        this->m_head_idx -= size;
+        dst = this->m_head.data() + this->m_head_idx;
+      }
+      else
+      {
+        return false;
+      }
+
+      SegmentedBlob::copy(dst, seg.data(), inner, false);
+      SegmentedBlob::copy(dst + inner, seg.data() + end, seg.size() - end, false);
+      this->m_segments[idx] = segment_t(dst, size);
+      this->m_used -= end - inner;
+      this->reclaim_buffers();
+      return true;
+    }
+
+    std::size_t segments_needed(std::size_t const& offset) const noexcept
+    {
+      if ((offset == 0) || (offset == this->m_used))
+        return 1;
+      std::size_t idx   = 0;
+      std::size_t inner = 0;
+      this->locate(offset, idx, inner);
+      return inner == 0 ? 1 : 2;
+    }
+
+    // Moves the free ends of the head and tail buffers back to the outermost bytes still referenced.
+    void reclaim_buffers() noexcept
+    {
+      std::size_t head_idx = head_size;
+      std::size_t tail_idx = 0;
+      for (std::size_t idx = 0; idx < this->m_count; idx++)
+      {
+        std::byte const* const begin = this->m_segments[idx].data();
+        std::byte const* const end   = begin + this->m_segments[idx].size();
+        if (SegmentedBlob::is_inside(begin, this->m_head.data(), head_size))
+          head_idx = std::min(head_idx, static_cast<std::size_t>(begin - this->m_head.data()));
+        if (SegmentedBlob::is_inside(begin, this->m_tail.data(), tail_size))
+          tail_idx = std::max(tail_idx, static_cast<std::size_t>(end - this->m_tail.data()));
+      }
+      this->m_head_idx = head_idx;
+      this->m_tail_idx = tail_idx;
+    }
+
+    static bool is_inside(std::byte const* ptr, std::byte const* buffer, std::size_t const& size) noexcept
+    {
+      return !std::less<std::byte const*>()(ptr, buffer) && std::less<std::byte const*>()(ptr, buffer + size);
+    }
+
+    void locate(std::size_t const& offset, std::size_t& idx, std::size_t& inner) const noexcept
+    {
+      inner = offset;
+      for (idx = 0; idx < this->m_count; idx++)
+      {
+        if (inner < this->m_segments[idx].size())
+          return;
+        inner -= this->m_segments[idx].size();
+      }
+      inner = 0;
+    }
+
+    void gather(std::size_t const& offset, std::byte* ptr, std::size_t const& number_of_bytes, bool reverse) const noexcept
+    {
+      std::size_t idx   = 0;
+      std::size_t inner = 0;
+      this->locate(offset, idx, inner);
+
+      std::size_t done = 0;
+      while (done < number_of_bytes)
+      {
+        segment_t const   seg   = this->m_segments[idx].subspan(inner);
+        std::size_t const chunk = (seg.size() < (number_of_bytes - done)) ? seg.size() : (number_of_bytes - done);
+        for (std::size_t i = 0; i < chunk; i++)
+        {
+          if (reverse)
+            ptr[number_of_bytes - 1 - (done + i)] = seg[i];
+          else
+            ptr[done + i] = seg[i];
+        }
+        done += chunk;
+        inner = 0;
+        idx++;
+      }
+    }
+
+    void shift_segments_right(std::size_t const& idx, std::size_t const& shift) noexcept
+    {
+      for (std::size_t i = this->m_count + shift; i > (idx + shift);)
+      {
+        --i;
+        this->m_segments[i] = this->m_segments[i - shift];
+      }
+      this->m_count += shift;
+    }
+
+    void shift_segments_left(std::size_t const& idx, std::size_t const& shift) noexcept
+    {
+      for (std::size_t i = idx - shift; i < this->m_count - shift; i++)
+      {
+        this->m_segments[i] = this->m_segments[i + shift];
+      }
+      this->m_count -= shift;
+    }
+
+    static void copy(std::byte* dst, std::byte const* src, std::size_t const& size, bool reverse) noexcept
+    {
+      for (std::size_t idx = 0; idx < size; idx++)
+      {
+        dst[idx] = reverse ? src[size - 1 - idx] : src[idx];
+      }
+    }
+
+    std::array<segment_t, max_segments> m_segments{};
+    std::size_t                          m_count    = 0;
+    std::size_t                          m_used     = 0;
+    std::size_t                          m_head_idx = head_size;
+    std::size_t                          m_tail_idx = 0;
+    std::array<std::byte, head_size>     m_head{};
+    std::array<std::byte, tail_size>     m_tail{};
+  };
+}    // namespace wlib::blob
+
+#endif    // !WLIB_BLOB_SEGMENTED_HPP_INCLUDED
@@ -0,0 +1,229 @@
+#pragma once
+#ifndef WLIB_BLOB_SERIALIZE_HPP_INCLUDED
+#define WLIB_BLOB_SERIALIZE_HPP_INCLUDED
+
+#include <wlib-BLOB.hpp>
+
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <type_traits>
+
+namespace wlib::blob
+{
+  // Append-only write API shared by the sinks below. Tsink provides
+  // append(src, number_of_bytes, reverse) and append_elements(src, number_of_elements, element_size, endian).
+  template <typename Tsink> class Sink_Interface
+  {
+  public:
+    constexpr bool try_insert_back(std::byte const& byte) noexcept
+    {
+      this->insert_back(byte);
+      return true;
+    }
+    constexpr bool try_insert_back(std::byte const* begin, std::size_t const& number_of_bytes) noexcept
+    {
+      this->insert_back(begin, number_of_bytes);
+      return true;
+    }
+    constexpr bool try_insert_back(std::byte const* begin, std::byte const* end) noexcept
+    {
+      this->insert_back(begin, end);
+      return true;
+    }
+    constexpr bool try_insert_back(std::span<std::byte const> const& data) noexcept
+    {
+      this->insert_back(data);
+      return true;
+    }
+    constexpr bool try_insert_back_reverse(std::byte const* begin, std::size_t const& number_of_bytes) noexcept
+    {
+      this->insert_back_reverse(begin, number_of_bytes);
+      return true;
+    }
+    constexpr bool try_insert_back_reverse(std::span<std::byte const> const& data) noexcept
+    {
+      this->insert_back_reverse(data);
+      return true;
+    }
+    template <ArithmeticOrByte T> constexpr bool try_insert_back(T const& value, std::endian endian = std::endian::native) noexcept
+    {
+      this->insert_back(value, endian);
+      return true;
+    }
+    template <ArithmeticOrByte T, std::endian endian> constexpr bool try_insert_back(T const& value) noexcept
+    {
+      this->template insert_back<T, endian>(value);
+      return true;
+    }
+    template <ArithmeticOrByte... Ts> requires(sizeof...(Ts) > 0) constexpr bool try_insert_back(std::endian endian, Ts const&... values) noexcept
+    {
+      this->insert_back(endian, values...);
+      return true;
+    }
+    template <ArithmeticOrByte T> constexpr bool try_insert_back(std::span<T const> const& values, std::endian endian = std::endian::native) noexcept
+    {
+      this->insert_back(values, endian);
+      return true;
+    }
+
+    constexpr void insert_back(std::byte const& byte) noexcept { this->sink().append(&byte, 1, false); }
+    constexpr void insert_back(std::byte const* begin, std::size_t const& number_of_bytes) noexcept { this->sink().append(begin, number_of_bytes, false); }
+    constexpr void insert_back(std::byte const* begin, std::byte const* end) noexcept { this->sink().append(begin, static_cast<std::size_t>(end - begin), false); }
+    constexpr void insert_back(std::span<std::byte const> const& data) noexcept { this->sink().append(data.data(), data.size(), false); }
+    constexpr void insert_back_reverse(std::byte const* begin, std::size_t const& number_of_bytes) noexcept { this->sink().append(begin, number_of_bytes, true); }
+    constexpr void insert_back_reverse(std::span<std::byte const> const& data) noexcept { this->sink().append(data.data(), data.size(), true); }
+
+    template <ArithmeticOrByte T> constexpr void insert_back(T const& value, std::endian endian = std::endian::native) noexcept
+    {
+      std::array<std::byte, sizeof(T)> const raw = std::bit_cast<std::array<std::byte, sizeof(T)>>(value);
+      this->sink().append(raw.data(), sizeof(T), endian != std::endian::native);
+    }
+    template <ArithmeticOrByte T, std::endian endian> constexpr void insert_back(T const& value) noexcept
+    {
+      T const                                 tmp = (endian == std::endian::native) ? value : wlib::blob::byteswap(value);
+      std::array<std::byte, sizeof(T)> const raw = std::bit_cast<std::array<std::byte, sizeof(T)>>(tmp);
+      this->sink().append(raw.data(), sizeof(T), false);
+    }
+    template <ArithmeticOrByte... Ts> requires(sizeof...(Ts) > 0) constexpr void insert_back(std::endian endian, Ts const&... values) noexcept
+    {
+      (this->insert_back(values, endian), ...);
+    }
+    template <ArithmeticOrByte T> constexpr void insert_back(std::span<T const> const& values, std::endian endian = std::endian::native) noexcept
+    {
+      if (std::is_constant_evaluated())
+      {
+        for (T const& value : values)
+          this->insert_back(value, endian);
+      }
+      else
+      {
+        this->sink().append_elements(reinterpret_cast<std::byte const*>(values.data()), values.size(), sizeof(T), endian);
+      }
+    }
+
+  protected:
+    constexpr Sink_Interface() noexcept = default;
+
+  private:
+    [[nodiscard]] constexpr Tsink& sink() noexcept { return *static_cast<Tsink*>(this); }
+  };
+
+  // Counts the bytes a serializer would write.
+  class SizingBlob: public Sink_Interface<SizingBlob>
+  {
+  public:
+    constexpr SizingBlob() noexcept = default;
+
+    [[nodiscard]] constexpr std::size_t get_number_of_used_bytes() const noexcept { return this->m_size; }
+    constexpr void                      clear() noexcept { this->m_size = 0; }
+
+  private:
+    friend class Sink_Interface<SizingBlob>;
+
+    constexpr void append(std::byte const*, std::size_t const& number_of_bytes, bool) noexcept { this->m_size += number_of_bytes; }
+    constexpr void append_elements(std::byte const*, std::size_t const& number_of_elements, std::size_t const& element_size, std::endian) noexcept
+    {
+      this->m_size += number_of_elements * element_size;
+    }
+
+    std::size_t m_size = 0;
+  };
+
+  // Writes into a window which is known to be large enough. The bounds are only asserted,
+  // release builds do no checks at all.
+  class UncheckedWriter: public Sink_Interface<UncheckedWriter>
+  {
+  public:
+    constexpr UncheckedWriter(std::byte* begin, std::size_t const& number_of_bytes) noexcept
+        : m_begin(begin)
+        , m_pos(begin)
+        , m_end(begin + number_of_bytes)
+    {
+    }
+
+    [[nodiscard]] constexpr std::size_t get_number_of_used_bytes() const noexcept { return static_cast<std::size_t>(this->m_pos - this->m_begin); }
+    [[nodiscard]] constexpr std::size_t get_number_of_free_bytes() const noexcept { return static_cast<std::size_t>(this->m_end - this->m_pos); }
+
+  private:
+    friend class Sink_Interface<UncheckedWriter>;
+
+    constexpr void append(std::byte const* src, std::size_t const& number_of_bytes, bool reverse) noexcept
+    {
+      assert(number_of_bytes <= this->get_number_of_free_bytes());
+      if (reverse)
+      {
+        for (std::size_t idx = 0; idx < number_of_bytes; idx++)
+          this->m_pos[idx] = src[number_of_bytes - 1 - idx];
+      }
+      else if (std::is_constant_evaluated())
+      {
+        for (std::size_t idx = 0; idx < number_of_bytes; idx++)
+          this->m_pos[idx] = src[idx];
+      }
+      else if (number_of_bytes != 0)
+      {
+        std::memcpy(this->m_pos, src, number_of_bytes);
+      }
+      this->m_pos += number_of_bytes;
+    }
+    void append_elements(std::byte const* src, std::size_t const& number_of_elements, std::size_t const& element_size, std::endian endian) noexcept
+    {
+      if (endian == std::endian::native || element_size == 1)
+        return this->append(src, number_of_elements * element_size, false);
+
+      assert((number_of_elements * element_size) <= this->get_number_of_free_bytes());
+      wlib::blob::byteswap_copy(this->m_pos, src, number_of_elements, element_size);
+      this->m_pos += number_of_elements * element_size;
+    }
+
+    std::byte* m_begin;
+    std::byte* m_pos;
+    std::byte* m_end;
+  };
+
+  // First pass of the two pass serialization: serializer(sink) is called with a SizingBlob.
+  template <typename Tserializer> [[nodiscard]] constexpr std::size_t measure(Tserializer&& serializer)
+  {
+    SizingBlob sizer;
+    serializer(sizer);
+    return sizer.get_number_of_used_bytes();
+  }
+
+  // Checks the room for number_of_bytes once and calls writer(UncheckedWriter&) on the free end
+  // of the blob. The bytes actually written by the writer are appended to the blob once it returns,
+  // so a writer that throws leaves the blob unchanged.
+  template <typename Tblob, typename Twriter> constexpr bool try_reserve_back(Blob_Interface<Tblob>& blob, std::size_t const& number_of_bytes, Twriter&& writer)
+  {
+    if (blob.get_number_of_free_bytes() < number_of_bytes)
+      return false;
+
+    UncheckedWriter window(blob.get_blob().data() + blob.get_number_of_used_bytes(), number_of_bytes);
+    writer(window);
+    blob.try_adjust_position(static_cast<std::ptrdiff_t>(window.get_number_of_used_bytes()));
+    return true;
+  }
+
+  template <typename Tblob, typename Twriter> constexpr void reserve_back(Blob_Interface<Tblob>& blob, std::size_t const& number_of_bytes, Twriter&& writer)
+  {
+    if (!wlib::blob::try_reserve_back(blob, number_of_bytes, writer))
+      return error::handle_insert_exception();
+  }
+
+  // Measures the serializer and appends its output to the blob with a single bounds check.
+  template <typename Tblob, typename Tserializer> constexpr bool try_serialize_back(Blob_Interface<Tblob>& blob, Tserializer&& serializer)
+  {
+    return wlib::blob::try_reserve_back(blob, wlib::blob::measure(serializer), serializer);
+  }
+
+  template <typename Tblob, typename Tserializer> constexpr void serialize_back(Blob_Interface<Tblob>& blob, Tserializer&& serializer)
+  {
+    if (!wlib::blob::try_serialize_back(blob, serializer))
+      return error::handle_insert_exception();
+  }
+}    // namespace wlib::blob
+
+#endif    // !WLIB_BLOB_SERIALIZE_HPP_INCLUDED
@@ -0,0 +1,180 @@
+#pragma once
+#ifndef WLIB_BLOB_SNAPSHOT_HPP_INCLUDED
+#define WLIB_BLOB_SNAPSHOT_HPP_INCLUDED
+
+#include <wlib-BLOB.hpp>
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+
+namespace wlib::blob
+{
+  // Reference counted chunk header, the chunk data follows it in the same allocation.
+  struct alignas(16) cow_chunk
+  {
+    std::atomic<std::uint32_t> references{ 1 };
+
+    [[nodiscard]] std::byte*       data() noexcept { return reinterpret_cast<std::byte*>(this + 1); }
+    [[nodiscard]] std::byte const* data() const noexcept { return reinterpret_cast<std::byte const*>(this + 1); }
+
+    [[nodiscard]] static cow_chunk* allocate(std::size_t const& chunk_size) noexcept;
+    static void                     release(cow_chunk* chunk) noexcept;
+  };
+
+  // Immutable state of a CowBlob, shares its chunks with the blob and with other snapshots.
+  // Reading and destroying a snapshot is safe on any thread while the blob keeps changing.
+  class BlobSnapshot
+  {
+  public:
+    BlobSnapshot() noexcept = default;
+    BlobSnapshot(BlobSnapshot const& other);
+    BlobSnapshot& operator=(BlobSnapshot const& other);
+    BlobSnapshot(BlobSnapshot&& other) noexcept;
+    BlobSnapshot& operator=(BlobSnapshot&& other) noexcept;
+    ~BlobSnapshot() { this->reset(); }
+
+    [[nodiscard]] std::size_t                get_number_of_used_bytes() const noexcept { return this->m_used; }
+    [[nodiscard]] std::size_t                get_chunk_size() const noexcept { return this->m_chunk_size; }
+    [[nodiscard]] std::size_t                get_number_of_chunks() const noexcept { return this->m_number_of_chunks; }
+    [[nodiscard]] std::span<std::byte const> get_chunk(std::size_t const& idx) const noexcept;
+    void                                     reset() noexcept;
+
+    bool try_read(std::size_t const& offset, std::byte* ptr, std::size_t const& number_of_bytes) const noexcept;
+    bool try_read_reverse(std::size_t const& offset, std::byte* ptr, std::size_t const& number_of_bytes) const noexcept;
+    template <ArithmeticOrByte T> bool try_read(std::size_t const& offset, T& value, std::endian endian = std::endian::native) const noexcept
+    {
+      if (endian == std::endian::native)
+        return this->try_read(offset, reinterpret_cast<std::byte*>(&value), sizeof(T));
+      else
+        return this->try_read_reverse(offset, reinterpret_cast<std::byte*>(&value), sizeof(T));
+    }
+
+    template <ArithmeticOrByte T> [[nodiscard]] T read(std::size_t const& offset, std::endian endian = std::endian::native) const
+    {
+      T ret{};
+      if (!this->try_read(offset, ret, endian))
+        error::handle_read_exception();
+      return ret;
+    }
+
+  private:
+    friend class CowBlob;
+
+    std::unique_ptr<cow_chunk*[]> m_chunks;
+    std::size_t                   m_number_of_chunks = 0;
+    std::size_t                   m_chunk_size       = 0;
+    std::size_t                   m_used             = 0;
+  };
+
+  // Fixed capacity blob in equally sized chunks, allocated on first write. snapshot() only takes a
+  // reference on the used chunks, a chunk is copied when it is written to while a snapshot still holds it.
+  // All members must be called by the writing thread, the snapshots may be handed to other threads.
+  class CowBlob
+  {
+  public:
+    static constexpr std::size_t default_chunk_size = 4096;
+
+    // A chunk_size of 0 goes to error::handle_insert_exception(), if that returns the blob has no capacity.
+    explicit CowBlob(std::size_t const& capacity, std::size_t const& chunk_size = default_chunk_size);
+    CowBlob(CowBlob const&)            = delete;
+    CowBlob& operator=(CowBlob const&) = delete;
+    ~CowBlob();
+
+    [[nodiscard]] std::size_t get_capacity() const noexcept { return this->m_capacity; }
+    [[nodiscard]] std::size_t get_number_of_used_bytes() const noexcept { return this->m_used; }
+    [[nodiscard]] std::size_t get_number_of_free_bytes() const noexcept { return this->m_capacity - this->m_used; }
+    [[nodiscard]] std::size_t get_chunk_size() const noexcept { return this->m_chunk_size; }
+    // Chunks duplicated because a snapshot still referenced them.
+    [[nodiscard]] std::size_t get_number_of_chunk_copies() const noexcept { return this->m_chunk_copies; }
+    void                      clear() noexcept { this->m_used = 0; }
+
+    // Shares the used chunks, O(number of chunks).
+    [[nodiscard]] BlobSnapshot snapshot() const;
+
+    bool try_insert_back(std::byte const* begin, std::size_t const& number_of_bytes) noexcept;
+    bool try_insert_back(std::span<std::byte const> const& data) noexcept { return this->try_insert_back(data.data(), data.size()); }
+    template <ArithmeticOrByte T> bool try_insert_back(T const& value, std::endian endian = std::endian::native) noexcept
+    {
+      T const tmp = (endian == std::endian::native) ? value : wlib::blob::byteswap(value);
+      return this->try_insert_back(reinterpret_cast<std::byte const*>(&tmp), sizeof(T));
+    }
+
+    bool try_overwrite(std::size_t const& offset, std::byte const* begin, std::size_t const& number_of_bytes) noexcept;
+    bool try_overwrite(std::size_t const& offset, std::span<std::byte const> const& data) noexcept { return this->try_overwrite(offset, data.data(), data.size()); }
+    template <ArithmeticOrByte T> bool try_overwrite(std::size_t const& offset, T const& value, std::endian endian = std::endian::native) noexcept
+    {
+      T const tmp = (endian == std::endian::native) ? value : wlib::blob::byteswap(value);
+      return this->try_overwrite(offset, reinterpret_cast<std::byte const*>(&tmp), sizeof(T));
+    }
+
+    bool try_read(std::size_t const& offset, std::byte* ptr, std::size_t const& number_of_bytes) const noexcept;
+    bool try_read_reverse(std::size_t const& offset, std::byte* ptr, std::size_t const& number_of_bytes) const noexcept;
+    template <ArithmeticOrByte T> bool try_read(std::size_t const& offset, T& value, std::endian endian = std::endian::native) const noexcept
+    {
+      if (endian == std::endian::native)
+        return this->try_read(offset, reinterpret_cast<std::byte*>(&value), sizeof(T));
+      else
+        return this->try_read_reverse(offset, reinterpret_cast<std::byte*>(&value), sizeof(T));
+    }
+
+    bool try_remove_back(std::size_t const& number_of_bytes = 1) noexcept
+    {
+      if (this->m_used < number_of_bytes)
+        return false;
+      this->m_used -= number_of_bytes;
+      return true;
+    }
+
+    void insert_back(std::byte const* begin, std::size_t const& number_of_bytes)
+    {
+      if (!this->try_insert_back(begin, number_of_bytes))
+        return error::handle_insert_exception();
+    }
+    void insert_back(std::span<std::byte const> const& data) { return this->insert_back(data.data(), data.size()); }
+    template <ArithmeticOrByte T> void insert_back(T const& value, std::endian endian = std::endian::native)
+    {
+      if (!this->try_insert_back(value, endian))
+        return error::handle_insert_exception();
+    }
+
+    void overwrite(std::size_t const& offset, std::byte const* begin, std::size_t const& number_of_bytes)
+    {
+      if (!this->try_overwrite(offset, begin, number_of_bytes))
+        return error::handle_overwrite_exception();
+    }
+    template <ArithmeticOrByte T> void overwrite(std::size_t const& offset, T const& value, std::endian endian = std::endian::native)
+    {
+      if (!this->try_overwrite(offset, value, endian))
+        return error::handle_overwrite_exception();
+    }
+
+    template <ArithmeticOrByte T> [[nodiscard]] T read(std::size_t const& offset, std::endian endian = std::endian::native) const
+    {
+      T ret{};
+      if (!this->try_read(offset, ret, endian))
+        error::handle_read_exception();
+      return ret;
+    }
+
+    void remove_back(std::size_t const& number_of_bytes = 1)
+    {
+      if (!this->try_remove_back(number_of_bytes))
+        return error::handle_remove_exception();
+    }
+
+  private:
+    bool try_write(std::size_t const& offset, std::byte const* begin, std::size_t const& number_of_bytes) noexcept;
+
+    std::size_t                   m_capacity;
+    std::size_t                   m_chunk_size;
+    std::size_t                   m_used         = 0;
+    std::size_t                   m_chunk_copies = 0;
+    std::unique_ptr<cow_chunk*[]> m_chunks;
+  };
+}    // namespace wlib::blob
+
+#endif    // !WLIB_BLOB_SNAPSHOT_HPP_INCLUDED
@@ -0,0 +1,136 @@
+#pragma once
+#ifndef WLIB_BLOB_STUFFING_HPP_INCLUDED
+#define WLIB_BLOB_STUFFING_HPP_INCLUDED
+
+#include <wlib-BLOB.hpp>
+
+#include <cstddef>
+#include <span>
+
+// Byte stuffing for stream links. Encoding writes a complete frame including the trailing
+// delimiter, decoding accepts a frame with or without it. The delimiter scans use the SIMD
+// search of wlib-BLOB_Search.hpp, so runs without special bytes are copied with memcpy.
+namespace wlib::blob::cobs
+{
+  inline constexpr std::byte delimiter{ 0x00 };
+
+  // Code bytes plus the delimiter, exact for data without zero bytes and an upper bound otherwise.
+  [[nodiscard]] constexpr std::size_t max_encoded_size(std::size_t const& number_of_bytes) noexcept
+  {
+    return (number_of_bytes == 0) ? 2 : (number_of_bytes + (number_of_bytes + 253) / 254 + 1);
+  }
+  [[nodiscard]] constexpr std::size_t max_decoded_size(std::size_t const& number_of_bytes) noexcept { return number_of_bytes; }
+
+  // dst needs max_encoded_size(number_of_bytes) bytes, returns the bytes written.
+  std::size_t encode(std::byte* dst, std::byte const* src, std::size_t const& number_of_bytes) noexcept;
+  // dst needs max_decoded_size(number_of_bytes) bytes and may equal src. Fails on malformed frames.
+  bool decode(std::byte* dst, std::byte const* src, std::size_t const& number_of_bytes, std::size_t& decoded_number_of_bytes) noexcept;
+}    // namespace wlib::blob::cobs
+
+namespace wlib::blob::slip
+{
+  inline constexpr std::byte end{ 0xC0 };
+  inline constexpr std::byte esc{ 0xDB };
+  inline constexpr std::byte esc_end{ 0xDC };
+  inline constexpr std::byte esc_esc{ 0xDD };
+
+  [[nodiscard]] constexpr std::size_t max_encoded_size(std::size_t const& number_of_bytes) noexcept { return 2 * number_of_bytes + 1; }
+  [[nodiscard]] constexpr std::size_t max_decoded_size(std::size_t const& number_of_bytes) noexcept { return number_of_bytes; }
+
+  std::size_t encode(std::byte* dst, std::byte const* src, std::size_t const& number_of_bytes) noexcept;
+  bool        decode(std::byte* dst, std::byte const* src, std::size_t const& number_of_bytes, std::size_t& decoded_number_of_bytes) noexcept;
+}    // namespace wlib::blob::slip
+
+namespace wlib::blob::stuffing
+{
+  using encode_t = std::size_t (*)(std::byte*, std::byte const*, std::size_t const&) noexcept;
+  using decode_t = bool (*)(std::byte*, std::byte const*, std::size_t const&, std::size_t&) noexcept;
+
+  template <typename Tblob> bool try_encode_back(Blob_Interface<Tblob>& dst, std::span<std::byte const> const& src, std::size_t const& max_size, encode_t encode) noexcept
+  {
+    if (dst.get_number_of_free_bytes() < max_size)
+      return false;
+    std::size_t const number_of_bytes = encode(dst.get_blob().data() + dst.get_number_of_used_bytes(), src.data(), src.size());
+    return dst.try_adjust_position(static_cast<std::ptrdiff_t>(number_of_bytes));
+  }
+
+  template <typename Tblob> bool try_decode_back(Blob_Interface<Tblob>& dst, std::span<std::byte const> const& src, decode_t decode) noexcept
+  {
+    if (dst.get_number_of_free_bytes() < src.size())
+      return false;
+    std::size_t number_of_bytes = 0;
+    if (!decode(dst.get_blob().data() + dst.get_number_of_used_bytes(), src.data(), src.size(), number_of_bytes))
+      return false;
+    return dst.try_adjust_position(static_cast<std::ptrdiff_t>(number_of_bytes));
+  }
+
+  // The used bytes are replaced by the decoded frame. On failure the position is kept but the content is undefined.
+  template <typename Tblob> bool try_decode_in_place(Blob_Interface<Tblob>& blob, decode_t decode) noexcept
+  {
+    std::span<std::byte> const frame           = blob.get_blob();
+    std::size_t                number_of_bytes = 0;
+    if (!decode(frame.data(), frame.data(), frame.size(), number_of_bytes))
+      return false;
+    return blob.try_set_position(number_of_bytes);
+  }
+}    // namespace wlib::blob::stuffing
+
+namespace wlib::blob::cobs
+{
+  template <typename Tblob> bool try_encode_back(Blob_Interface<Tblob>& dst, std::span<std::byte const> const& src) noexcept
+  {
+    return stuffing::try_encode_back(dst, src, cobs::max_encoded_size(src.size()), &cobs::encode);
+  }
+  template <typename Tblob> bool try_decode_back(Blob_Interface<Tblob>& dst, std::span<std::byte const> const& src) noexcept
+  {
+    return stuffing::try_decode_back(dst, src, &cobs::decode);
+  }
+  template <typename Tblob> bool try_decode_in_place(Blob_Interface<Tblob>& blob) noexcept { return stuffing::try_decode_in_place(blob, &cobs::decode); }
+
+  template <typename Tblob> void encode_back(Blob_Interface<Tblob>& dst, std::span<std::byte const> const& src)
+  {
+    if (!cobs::try_encode_back(dst, src))
+      return error::handle_insert_exception();
+  }
+  template <typename Tblob> void decode_back(Blob_Interface<Tblob>& dst, std::span<std::byte const> const& src)
+  {
+    if (!cobs::try_decode_back(dst, src))
+      return error::handle_read_exception();
+  }
+  template <typename Tblob> void decode_in_place(Blob_Interface<Tblob>& blob)
+  {
+    if (!cobs::try_decode_in_place(blob))
+      return error::handle_read_exception();
+  }
+}    // namespace wlib::blob::cobs
+
+namespace wlib::blob::slip
+{
+  template <typename Tblob> bool try_encode_back(Blob_Interface<Tblob>& dst, std::span<std::byte const> const& src) noexcept
+  {
+    return stuffing::try_encode_back(dst, src, slip::max_encoded_size(src.size()), &slip::encode);
+  }
+  template <typename Tblob> bool try_decode_back(Blob_Interface<Tblob>& dst, std::span<std::byte const> const& src) noexcept
+  {
+    return stuffing::try_decode_back(dst, src, &slip::decode);
+  }
+  template <typename Tblob> bool try_decode_in_place(Blob_Interface<Tblob>& blob) noexcept { return stuffing::try_decode_in_place(blob, &slip::decode); }
+
+  template <typename Tblob> void encode_back(Blob_Interface<Tblob>& dst, std::span<std::byte const> const& src)
+  {
+    if (!slip::try_encode_back(dst, src))
+      return error::handle_insert_exception();
+  }
+  template <typename Tblob> void decode_back(Blob_Interface<Tblob>& dst, std::span<std::byte const> const& src)
+  {
+    if (!slip::try_decode_back(dst, src))
+      return error::handle_read_exception();
+  }
+  template <typename Tblob> void decode_in_place(Blob_Interface<Tblob>& blob)
+  {
+    if (!slip::try_decode_in_place(blob))
+      return error::handle_read_exception();
+  }
+}    // namespace wlib::blob::slip
+
+#endif    // !WLIB_BLOB_STUFFING_HPP_INCLUDED
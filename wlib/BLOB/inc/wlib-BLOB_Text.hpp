@@ -0,0 +1,102 @@
+#pragma once
+#ifndef WLIB_BLOB_TEXT_HPP_INCLUDED
+#define WLIB_BLOB_TEXT_HPP_INCLUDED
+
+#include <wlib-BLOB.hpp>
+
+#include <cstddef>
+#include <span>
+#include <string_view>
+
+namespace wlib::blob
+{
+  enum class text_validation
+  {
+    strict,     // only alphabet characters, base64 needs its padding and zero trailing bits
+    lenient     // whitespace (any byte <= 0x20) is skipped, base64 padding is optional
+  };
+
+  enum class letter_case
+  {
+    lower,
+    upper
+  };
+}    // namespace wlib::blob
+
+namespace wlib::blob::hex
+{
+  [[nodiscard]] constexpr std::size_t encoded_size(std::size_t const& number_of_bytes) noexcept { return 2 * number_of_bytes; }
+  // Exact for valid input.
+  [[nodiscard]] std::size_t decoded_size(std::string_view const& text, text_validation validation = text_validation::strict) noexcept;
+
+  // dst needs encoded_size(number_of_bytes) characters.
+  void encode(char* dst, std::byte const* src, std::size_t const& number_of_bytes, letter_case letters = letter_case::lower) noexcept;
+  bool decode(std::byte* dst, std::size_t const& capacity, std::string_view const& text, text_validation validation, std::size_t& number_of_bytes) noexcept;
+}    // namespace wlib::blob::hex
+
+namespace wlib::blob::base64
+{
+  [[nodiscard]] constexpr std::size_t encoded_size(std::size_t const& number_of_bytes) noexcept { return (number_of_bytes + 2) / 3 * 4; }
+  [[nodiscard]] std::size_t           decoded_size(std::string_view const& text, text_validation validation = text_validation::strict) noexcept;
+
+  void encode(char* dst, std::byte const* src, std::size_t const& number_of_bytes) noexcept;
+  bool decode(std::byte* dst, std::size_t const& capacity, std::string_view const& text, text_validation validation, std::size_t& number_of_bytes) noexcept;
+}    // namespace wlib::blob::base64
+
+namespace wlib::blob::hex
+{
+  template <typename Tblob> bool try_encode_back(Blob_Interface<Tblob>& dst, std::span<std::byte const> const& src, letter_case letters = letter_case::lower) noexcept
+  {
+    if (dst.get_number_of_free_bytes() < hex::encoded_size(src.size()))
+      return false;
+    hex::encode(reinterpret_cast<char*>(dst.get_blob().data() + dst.get_number_of_used_bytes()), src.data(), src.size(), letters);
+    return dst.try_adjust_position(static_cast<std::ptrdiff_t>(hex::encoded_size(src.size())));
+  }
+  template <typename Tblob> bool try_decode_back(Blob_Interface<Tblob>& dst, std::string_view const& text, text_validation validation = text_validation::strict) noexcept
+  {
+    std::size_t number_of_bytes = 0;
+    if (!hex::decode(dst.get_blob().data() + dst.get_number_of_used_bytes(), dst.get_number_of_free_bytes(), text, validation, number_of_bytes))
+      return false;
+    return dst.try_adjust_position(static_cast<std::ptrdiff_t>(number_of_bytes));
+  }
+  template <typename Tblob> void encode_back(Blob_Interface<Tblob>& dst, std::span<std::byte const> const& src, letter_case letters = letter_case::lower)
+  {
+    if (!hex::try_encode_back(dst, src, letters))
+      return error::handle_insert_exception();
+  }
+  template <typename Tblob> void decode_back(Blob_Interface<Tblob>& dst, std::string_view const& text, text_validation validation = text_validation::strict)
+  {
+    if (!hex::try_decode_back(dst, text, validation))
+      return error::handle_read_exception();
+  }
+}    // namespace wlib::blob::hex
+
+namespace wlib::blob::base64
+{
+  template <typename Tblob> bool try_encode_back(Blob_Interface<Tblob>& dst, std::span<std::byte const> const& src) noexcept
+  {
+    if (dst.get_number_of_free_bytes() < base64::encoded_size(src.size()))
+      return false;
+    base64::encode(reinterpret_cast<char*>(dst.get_blob().data() + dst.get_number_of_used_bytes()), src.data(), src.size());
+    return dst.try_adjust_position(static_cast<std::ptrdiff_t>(base64::encoded_size(src.size())));
+  }
+  template <typename Tblob> bool try_decode_back(Blob_Interface<Tblob>& dst, std::string_view const& text, text_validation validation = text_validation::strict) noexcept
+  {
+    std::size_t number_of_bytes = 0;
+    if (!base64::decode(dst.get_blob().data() + dst.get_number_of_used_bytes(), dst.get_number_of_free_bytes(), text, validation, number_of_bytes))
+      return false;
+    return dst.try_adjust_position(static_cast<std::ptrdiff_t>(number_of_bytes));
+  }
+  template <typename Tblob> void encode_back(Blob_Interface<Tblob>& dst, std::span<std::byte const> const& src)
+  {
+    if (!base64::try_encode_back(dst, src))
+      return error::handle_insert_exception();
+  }
+  template <typename Tblob> void decode_back(Blob_Interface<Tblob>& dst, std::string_view const& text, text_validation validation = text_validation::strict)
+  {
+    if (!base64::try_decode_back(dst, text, validation))
+      return error::handle_read_exception();
+  }
+}    // namespace wlib::blob::base64
+
+#endif    // !WLIB_BLOB_TEXT_HPP_INCLUDED
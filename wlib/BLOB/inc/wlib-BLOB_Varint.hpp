@@ -0,0 +1,241 @@
+#pragma once
+#ifndef WLIB_BLOB_VARINT_HPP_INCLUDED
+#define WLIB_BLOB_VARINT_HPP_INCLUDED
+
+#include <wlib-BLOB.hpp>
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+namespace wlib::blob::varint
+{
+  // Unsigned integers are encoded as LEB128, signed integers are zig-zag mapped first.
+  template <std::integral T> inline constexpr std::size_t max_size_v = (std::numeric_limits<std::make_unsigned_t<T>>::digits + 6) / 7;
+
+  template <std::signed_integral T> [[nodiscard]] constexpr std::make_unsigned_t<T> zigzag_encode(T const& value) noexcept
+  {
+    using U = std::make_unsigned_t<T>;
+    return static_cast<U>(static_cast<U>(static_cast<U>(value) << 1) ^ static_cast<U>(value >> std::numeric_limits<U>::digits - 1));
+  }
+
+  template <std::unsigned_integral T> [[nodiscard]] constexpr std::make_signed_t<T> zigzag_decode(T const& value) noexcept
+  {
+    return static_cast<std::make_signed_t<T>>(static_cast<T>(value >> 1) ^ static_cast<T>(0U - (value & 1U)));
+  }
+
+  template <std::integral T> [[nodiscard]] constexpr std::size_t size(T const& value) noexcept
+  {
+    if constexpr (std::is_signed_v<T>)
+    {
+      return varint::size(varint::zigzag_encode(value));
+    }
+    else
+    {
+      std::size_t number_of_bytes = 1;
+      for (T rest = value >> 7; rest != 0; rest >>= 7)
+        number_of_bytes++;
+      return number_of_bytes;
+    }
+  }
+
+  // dst needs room for max_size_v<T> bytes, returns the number of bytes written
+  template <std::integral T> constexpr std::size_t encode(std::byte* dst, T const& value) noexcept
+  {
+    if constexpr (std::is_signed_v<T>)
+    {
+      return varint::encode(dst, varint::zigzag_encode(value));
+    }
+    else
+    {
+      std::size_t idx  = 0;
+      T           rest = value;
+      while (rest >= 0x80)
+      {
+        dst[idx++] = static_cast<std::byte>((rest & 0x7F) | 0x80);
+        rest >>= 7;
+      }
+      dst[idx++] = static_cast<std::byte>(rest);
+      return idx;
+    }
+  }
+
+  // returns the number of bytes consumed, 0 if the input is truncated or does not fit into T
+  template <std::integral T> constexpr std::size_t decode(std::byte const* src, std::size_t const& size, T& value) noexcept
+  {
+    if constexpr (std::is_signed_v<T>)
+    {
+      std::make_unsigned_t<T> raw = 0;
+      std::size_t const       ret = varint::decode(src, size, raw);
+      if (ret != 0)
+        value = varint::zigzag_decode(raw);
+      return ret;
+    }
+    else
+    {
+      constexpr std::size_t digits = std::numeric_limits<T>::digits;
+
+      T result = 0;
+      for (std::size_t idx = 0; (idx < size) && (idx < max_size_v<T>); idx++)
+      {
+        T const           bits  = static_cast<T>(src[idx] & std::byte(0x7F));
+        std::size_t const shift = 7 * idx;
+        if ((idx == (max_size_v<T> - 1)) && ((bits >> (digits - shift)) != 0))
+          return 0;
+
+        result = static_cast<T>(result | static_cast<T>(bits << shift));
+        if ((src[idx] & std::byte(0x80)) == std::byte(0))
+        {
+          value = result;
+          return idx + 1;
+        }
+      }
+      return 0;
+    }
+  }
+
+  std::size_t decode(std::byte const* src, std::size_t const& size, std::span<uint32_t> const& values) noexcept;
+  std::size_t decode(std::byte const* src, std::size_t const& size, std::span<uint64_t> const& values) noexcept;
+
+  // Decodes values.size() consecutive varints, returns the number of bytes consumed or 0 on malformed input.
+  template <std::integral T> std::size_t decode(std::byte const* src, std::size_t const& size, std::span<T> const& values) noexcept
+  {
+    using U = std::make_unsigned_t<T>;
+    if constexpr (std::is_same_v<U, uint32_t> || std::is_same_v<U, uint64_t>)
+    {
+      std::span<U> const raw(reinterpret_cast<U*>(values.data()), values.size());
+      std::size_t const  ret = varint::decode(src, size, raw);
+      if constexpr (std::is_signed_v<T>)
+      {
+        if (ret != 0)
+        {
+          for (std::size_t idx = 0; idx < values.size(); idx++)
+            values[idx] = varint::zigzag_decode(raw[idx]);
+        }
+      }
+      return ret;
+    }
+    else
+    {
+      std::size_t idx = 0;
+      for (T& value : values)
+      {
+        std::size_t const ret = varint::decode(&src[idx], size - idx, value);
+        if (ret == 0)
+          return 0;
+        idx += ret;
+      }
+      return idx;
+    }
+  }
+}    // namespace wlib::blob::varint
+
+namespace wlib::blob
+{
+  template <typename Tblob, std::integral T> constexpr bool try_insert_varint_back(Blob_Interface<Tblob>& blob, T const& value) noexcept
+  {
+    std::array<std::byte, varint::max_size_v<T>> raw{};
+    return blob.try_insert_back(raw.data(), varint::encode(raw.data(), value));
+  }
+
+  template <typename Tblob, std::integral T> bool try_insert_varint_back(Blob_Interface<Tblob>& blob, std::span<T const> const& values) noexcept
+  {
+    std::size_t number_of_bytes = 0;
+    for (T const& value : values)
+      number_of_bytes += varint::size(value);
+    if (blob.get_number_of_free_bytes() < number_of_bytes)
+      return false;
+
+    std::array<std::byte, 256> raw{};
+    std::size_t                idx = 0;
+    for (T const& value : values)
+    {
+      if ((raw.size() - idx) < varint::max_size_v<T>)
+      {
+        blob.try_insert_back(raw.data(), idx);
+        idx = 0;
+      }
+      idx += varint::encode(&raw[idx], value);
+    }
+    return blob.try_insert_back(raw.data(), idx);
+  }
+
+  // offset is advanced behind the decoded varint(s) on success
+  template <typename Tblob, std::integral T> constexpr bool try_read_varint(Blob_Interface<Tblob> const& blob, std::size_t& offset, T& value) noexcept
+  {
+    std::span<std::byte const> const data = blob.get_blob();
+    if (data.size() < offset)
+      return false;
+
+    std::size_t const ret = varint::decode(data.data() + offset, data.size() - offset, value);
+    if (ret == 0)
+      return false;
+    offset += ret;
+    return true;
+  }
+
+  template <typename Tblob, std::integral T> bool try_read_varint(Blob_Interface<Tblob> const& blob, std::size_t& offset, std::span<T> const& values) noexcept
+  {
+    std::span<std::byte const> const data = blob.get_blob();
+    if (data.size() < offset)
+      return false;
+    if (values.empty())
+      return true;
+
+    std::size_t const ret = varint::decode(data.data() + offset, data.size() - offset, values);
+    if (ret == 0)
+      return false;
+    offset += ret;
+    return true;
+  }
+
+  template <typename Tblob, std::integral T> constexpr bool try_extract_varint_front(Blob_Interface<Tblob>& blob, T& value) noexcept
+  {
+    std::size_t offset = 0;
+    T           tmp    = 0;
+    if (!wlib::blob::try_read_varint(blob, offset, tmp))
+      return false;
+    value = tmp;
+    return blob.try_remove_front(offset);
+  }
+
+  template <typename Tblob, std::integral T> constexpr void insert_varint_back(Blob_Interface<Tblob>& blob, T const& value)
+  {
+    if (!wlib::blob::try_insert_varint_back(blob, value))
+      return error::handle_insert_exception();
+  }
+
+  template <typename Tblob, std::integral T> void insert_varint_back(Blob_Interface<Tblob>& blob, std::span<T const> const& values)
+  {
+    if (!wlib::blob::try_insert_varint_back(blob, values))
+      return error::handle_insert_exception();
+  }
+
+  template <std::integral T, typename Tblob> [[nodiscard]] constexpr T read_varint(Blob_Interface<Tblob> const& blob, std::size_t& offset)
+  {
+    T value = 0;
+    if (!wlib::blob::try_read_varint(blob, offset, value))
+      error::handle_read_exception();
+    return value;
+  }
+
+  template <typename Tblob, std::integral T> void read_varint(Blob_Interface<Tblob> const& blob, std::size_t& offset, std::span<T> const& values)
+  {
+    if (!wlib::blob::try_read_varint(blob, offset, values))
+      return error::handle_read_exception();
+  }
+
+  template <std::integral T, typename Tblob> [[nodiscard]] constexpr T extract_varint_front(Blob_Interface<Tblob>& blob)
+  {
+    T value = 0;
+    if (!wlib::blob::try_extract_varint_front(blob, value))
+      error::handle_remove_exception();
+    return value;
+  }
+}    // namespace wlib::blob
+
+#endif    // !WLIB_BLOB_VARINT_HPP_INCLUDED
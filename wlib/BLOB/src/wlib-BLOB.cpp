@@ -3,11 +3,102 @@
 //
 #include <stdexcept>
 
+#include "wlib-BLOB_Cpu.hpp"
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#define WLIB_BLOB_NEON 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define WLIB_BLOB_SSE2 1
+#endif
+
+namespace wlib::blob::error
+{
+  void handle_overwrite_exception() { throw std::out_of_range("not enouth room to insert object"); }
+  void handle_insert_exception() { throw std::out_of_range("not enouth room to insert object"); }
+  void handle_remove_exception() { throw std::out_of_range("not enouth bytes left"); }
+  void handle_read_exception() { throw std::out_of_range("not enouth bytes left to read"); }
+  void handle_position_exception() { throw std::out_of_range("not enouth bytes left to read"); }
+}    // namespace wlib::blob::error
+
 namespace wlib::blob
 {
-  void MemoryBlob::handle_overwrite_exception() { throw std::out_of_range("not enouth room to insert object"); }
-  void MemoryBlob::handle_insert_exception() { throw std::out_of_range("not enouth room to insert object"); }
-  void MemoryBlob::handle_remove_exception() { throw std::out_of_range("not enouth bytes left"); }
-  void MemoryBlob::handle_read_exception() { throw std::out_of_range("not enouth bytes left to read"); }
-  void MemoryBlob::handle_position_exception() { throw std::out_of_range("not enouth bytes left to read"); }
+#if defined(WLIB_BLOB_NEON) || defined(WLIB_BLOB_SSE2)
+  namespace
+  {
+    constexpr std::size_t vector_size = 16;
+
+#if defined(WLIB_BLOB_NEON)
+    void byteswap_block(std::byte* dst, std::byte const* src, std::size_t const& element_size)
+    {
+      uint8x16_t const v = vld1q_u8(reinterpret_cast<uint8_t const*>(src));
+      if (element_size == 2)
+        vst1q_u8(reinterpret_cast<uint8_t*>(dst), vrev16q_u8(v));
+      else if (element_size == 4)
+        vst1q_u8(reinterpret_cast<uint8_t*>(dst), vrev32q_u8(v));
+      else
+        vst1q_u8(reinterpret_cast<uint8_t*>(dst), vrev64q_u8(v));
+    }
+#else
+    void byteswap_block(std::byte* dst, std::byte const* src, std::size_t const& element_size)
+    {
+      __m128i v = _mm_loadu_si128(reinterpret_cast<__m128i const*>(src));
+      if (element_size == 4)
+        v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1));
+      else if (element_size == 8)
+        v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, _MM_SHUFFLE(0, 1, 2, 3)), _MM_SHUFFLE(0, 1, 2, 3));
+      v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), v);
+    }
+#endif
+
+#if defined(WLIB_BLOB_CPU_SSSE3)
+    // One pshufb per block, returns the number of bytes swapped.
+    WLIB_BLOB_SSSE3_TARGET std::size_t byteswap_blocks_ssse3(std::byte* dst, std::byte const* src, std::size_t const& number_of_bytes, std::size_t const& element_size)
+    {
+      __m128i const msk_16 = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+      __m128i const msk_32 = _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+      __m128i const msk_64 = _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+      __m128i const msk    = (element_size == 2) ? msk_16 : ((element_size == 4) ? msk_32 : msk_64);
+
+      std::size_t idx = 0;
+      for (; (idx + vector_size) <= number_of_bytes; idx += vector_size)
+      {
+        __m128i const v = _mm_loadu_si128(reinterpret_cast<__m128i const*>(&src[idx]));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&dst[idx]), _mm_shuffle_epi8(v, msk));
+      }
+      return idx;
+    }
+#endif
+  }    // namespace
+#endif
+
+  void byteswap_copy(std::byte* dst, std::byte const* src, std::size_t const& number_of_elements, std::size_t const& element_size) noexcept
+  {
+    std::size_t       idx             = 0;
+    std::size_t const number_of_bytes = number_of_elements * element_size;
+
+#if defined(WLIB_BLOB_NEON) || defined(WLIB_BLOB_SSE2)
+    if (element_size == 2 || element_size == 4 || element_size == 8)
+    {
+#if defined(WLIB_BLOB_CPU_SSSE3)
+      if (cpu::has_ssse3())
+        idx = byteswap_blocks_ssse3(dst, src, number_of_bytes, element_size);
+#endif
+      for (; (idx + vector_size) <= number_of_bytes; idx += vector_size)
+      {
+        byteswap_block(&dst[idx], &src[idx], element_size);
+      }
+    }
+#endif
+
+    for (; idx < number_of_bytes; idx += element_size)
+    {
+      for (std::size_t i = 0; i < element_size; i++)
+      {
+        dst[idx + i] = src[idx + element_size - 1 - i];
+      }
+    }
+  }
 }    // namespace wlib::blob
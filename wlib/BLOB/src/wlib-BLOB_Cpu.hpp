@@ -0,0 +1,86 @@
+#pragma once
+#ifndef WLIB_BLOB_CPU_HPP_INCLUDED
+#define WLIB_BLOB_CPU_HPP_INCLUDED
+
+// Private to the BLOB sources. SSSE3 and AVX2 kernels are built on every x86-64 compiler, either because
+// the flags enable the instruction set already or through a target attribute, and are picked at runtime
+// by cpu::has_ssse3() and cpu::has_avx2().
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#define WLIB_BLOB_CPU_SSSE3 1
+#define WLIB_BLOB_SSSE3_TARGET
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#include <tmmintrin.h>
+#define WLIB_BLOB_CPU_SSSE3 1
+#define WLIB_BLOB_SSSE3_TARGET __attribute__((target("ssse3")))
+#elif defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#include <tmmintrin.h>
+#define WLIB_BLOB_CPU_SSSE3 1
+#define WLIB_BLOB_SSSE3_TARGET
+#endif
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define WLIB_BLOB_CPU_AVX2 1
+#define WLIB_BLOB_AVX2_TARGET
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#include <immintrin.h>
+#define WLIB_BLOB_CPU_AVX2 1
+#define WLIB_BLOB_AVX2_TARGET __attribute__((target("avx2")))
+#elif defined(_MSC_VER) && defined(_M_X64)
+#include <immintrin.h>
+#include <intrin.h>
+#define WLIB_BLOB_CPU_AVX2 1
+#define WLIB_BLOB_AVX2_TARGET
+#endif
+
+#if defined(WLIB_BLOB_CPU_SSSE3)
+namespace wlib::blob::cpu
+{
+  [[nodiscard]] inline bool has_ssse3() noexcept
+  {
+#if defined(__SSSE3__)
+    return true;
+#elif defined(_MSC_VER)
+    static bool const result = [] {
+      int info[4];
+      __cpuid(info, 1);
+      return (info[2] & (1 << 9)) != 0;
+    }();
+    return result;
+#else
+    static bool const result = __builtin_cpu_supports("ssse3");
+    return result;
+#endif
+  }
+}    // namespace wlib::blob::cpu
+#endif
+
+#if defined(WLIB_BLOB_CPU_AVX2)
+namespace wlib::blob::cpu
+{
+  [[nodiscard]] inline bool has_avx2() noexcept
+  {
+#if defined(__AVX2__)
+    return true;
+#elif defined(_MSC_VER)
+    // The OS must also save the YMM registers (OSXSAVE and XCR0 bits 1 and 2).
+    static bool const result = [] {
+      int info[4];
+      __cpuid(info, 1);
+      if (((info[2] & (1 << 27)) == 0) || ((_xgetbv(0) & 0x6) != 0x6))
+        return false;
+      __cpuidex(info, 7, 0);
+      return (info[1] & (1 << 5)) != 0;
+    }();
+    return result;
+#else
+    static bool const result = __builtin_cpu_supports("avx2");
+    return result;
+#endif
+  }
+}    // namespace wlib::blob::cpu
+#endif
+
+#endif    // !WLIB_BLOB_CPU_HPP_INCLUDED
@@ -0,0 +1,153 @@
+#include <wlib-BLOB_Delta.hpp>
+
+//
+#include <bit>
+#include <cstring>
+
+#include "wlib-BLOB_Cpu.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define WLIB_BLOB_DELTA_SSE2 1
+#endif
+
+namespace wlib::blob::delta
+{
+  namespace
+  {
+#if defined(WLIB_BLOB_CPU_AVX2)
+    // Compares whole 32 byte blocks from idx. On a difference idx is its index, otherwise the first
+    // byte left for the SSE2 and scalar loops.
+    WLIB_BLOB_AVX2_TARGET bool mismatch_avx2(std::byte const* a, std::byte const* b, std::size_t const& number_of_bytes, std::size_t& idx) noexcept
+    {
+      for (; idx + 32 <= number_of_bytes; idx += 32)
+      {
+        __m256i const       va   = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(a + idx));
+        __m256i const       vb   = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(b + idx));
+        std::uint32_t const mask = ~static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(va, vb)));
+        if (mask != 0)
+        {
+          idx += static_cast<std::size_t>(std::countr_zero(mask));
+          return true;
+        }
+      }
+      return false;
+    }
+#endif
+
+    // Index of the first differing byte, number_of_bytes if there is none.
+    std::size_t mismatch(std::byte const* a, std::byte const* b, std::size_t const& number_of_bytes) noexcept
+    {
+      std::size_t idx = 0;
+#if defined(WLIB_BLOB_CPU_AVX2)
+      if (cpu::has_avx2() && mismatch_avx2(a, b, number_of_bytes, idx))
+        return idx;
+#endif
+#if defined(WLIB_BLOB_DELTA_SSE2)
+      for (; idx + 16 <= number_of_bytes; idx += 16)
+      {
+        __m128i const       va   = _mm_loadu_si128(reinterpret_cast<__m128i const*>(a + idx));
+        __m128i const       vb   = _mm_loadu_si128(reinterpret_cast<__m128i const*>(b + idx));
+        std::uint32_t const mask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(va, vb))) ^ 0xFFFF;
+        if (mask != 0)
+          return idx + static_cast<std::size_t>(std::countr_zero(mask));
+      }
+#endif
+      for (; idx < number_of_bytes; idx++)
+      {
+        if (a[idx] != b[idx])
+          return idx;
+      }
+      return number_of_bytes;
+    }
+
+    bool equal_word(std::byte const* a, std::byte const* b, std::size_t const& number_of_bytes) noexcept
+    {
+      if (number_of_bytes < word_size)
+        return std::memcmp(a, b, number_of_bytes) == 0;
+      std::uint64_t wa;
+      std::uint64_t wb;
+      std::memcpy(&wa, a, word_size);
+      std::memcpy(&wb, b, word_size);
+      return wa == wb;
+    }
+
+    bool write_run(std::byte*& op, std::byte const* end, std::size_t const& gap, std::byte const* data, std::size_t const& number_of_bytes) noexcept
+    {
+      if (static_cast<std::size_t>(end - op) < (varint::size(gap) + varint::size(number_of_bytes) + number_of_bytes))
+        return false;
+      op += varint::encode(op, static_cast<std::uint64_t>(gap));
+      op += varint::encode(op, static_cast<std::uint64_t>(number_of_bytes));
+      std::memcpy(op, data, number_of_bytes);
+      op += number_of_bytes;
+      return true;
+    }
+  }    // namespace
+
+  std::size_t encode(std::byte* dst, std::size_t const& capacity, std::span<std::byte const> const& previous, std::span<std::byte const> const& current) noexcept
+  {
+    std::byte*             op  = dst;
+    std::byte const* const end = dst + capacity;
+    if (capacity < varint::size(current.size()))
+      return 0;
+    op += varint::encode(op, static_cast<std::uint64_t>(current.size()));
+
+    std::size_t const common   = (previous.size() < current.size()) ? previous.size() : current.size();
+    std::size_t       pos      = 0;
+    std::size_t       last_end = 0;
+    while (pos < common)
+    {
+      pos += mismatch(previous.data() + pos, current.data() + pos, common - pos);
+      if (pos == common)
+        break;
+
+      std::size_t const start = pos - (pos % word_size);
+      std::size_t       stop  = start;
+      while ((stop < common) && !equal_word(previous.data() + stop, current.data() + stop, (common - stop < word_size) ? (common - stop) : word_size))
+        stop += word_size;
+      if (common < stop)
+        stop = common;
+      // Grown blobs continue the last run with the appended bytes.
+      if (stop == common)
+        stop = current.size();
+
+      if (!write_run(op, end, start - last_end, current.data() + start, stop - start))
+        return 0;
+      last_end = stop;
+      pos      = stop;
+    }
+    if ((last_end < current.size()) && (common < current.size()))
+    {
+      if (!write_run(op, end, common - last_end, current.data() + common, current.size() - common))
+        return 0;
+    }
+    return static_cast<std::size_t>(op - dst);
+  }
+
+  bool validate(std::span<std::byte const> const& delta, std::size_t const& capacity, std::size_t& new_number_of_bytes) noexcept
+  {
+    std::uint64_t value = 0;
+    std::size_t   idx   = varint::decode(delta.data(), delta.size(), value);
+    if ((idx == 0) || (capacity < value))
+      return false;
+
+    std::size_t const size   = static_cast<std::size_t>(value);
+    std::size_t       offset = 0;
+    while (idx < delta.size())
+    {
+      std::size_t const gap_size = varint::decode(delta.data() + idx, delta.size() - idx, value);
+      if ((gap_size == 0) || ((size - offset) < value))
+        return false;
+      idx += gap_size;
+      offset += static_cast<std::size_t>(value);
+
+      std::size_t const length_size = varint::decode(delta.data() + idx, delta.size() - idx, value);
+      if ((length_size == 0) || ((size - offset) < value) || ((delta.size() - idx - length_size) < value))
+        return false;
+      idx += length_size + static_cast<std::size_t>(value);
+      offset += static_cast<std::size_t>(value);
+    }
+    new_number_of_bytes = size;
+    return true;
+  }
+}    // namespace wlib::blob::delta
@@ -0,0 +1,179 @@
+#include <wlib-BLOB_File.hpp>
+
+#if defined(WLIB_BLOB_FILE_MAPPING)
+//
+#include <cerrno>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace wlib::blob::error
+{
+  void handle_file_exception() { throw std::system_error(errno, std::generic_category()); }
+}    // namespace wlib::blob::error
+
+namespace wlib::blob
+{
+  namespace
+  {
+    int to_madvise(file_advice advice) noexcept
+    {
+      switch (advice)
+      {
+        case file_advice::sequential:
+          return MADV_SEQUENTIAL;
+        case file_advice::random:
+          return MADV_RANDOM;
+        case file_advice::will_need:
+          return MADV_WILLNEED;
+        case file_advice::dont_need:
+          return MADV_DONTNEED;
+        default:
+          return MADV_NORMAL;
+      }
+    }
+  }    // namespace
+
+  FileBlob::FileBlob(FileBlob&& other) noexcept
+      : m_data(std::exchange(other.m_data, nullptr))
+      , m_size(std::exchange(other.m_size, 0))
+      , m_fd(std::exchange(other.m_fd, -1))
+      , m_access(other.m_access)
+  {
+  }
+
+  FileBlob& FileBlob::operator=(FileBlob&& other) noexcept
+  {
+    if (this != &other)
+    {
+      this->close();
+      this->m_data   = std::exchange(other.m_data, nullptr);
+      this->m_size   = std::exchange(other.m_size, 0);
+      this->m_fd     = std::exchange(other.m_fd, -1);
+      this->m_access = other.m_access;
+    }
+    return *this;
+  }
+
+  FileBlob::~FileBlob() { this->close(); }
+
+  BlobView FileBlob::get_writable_view() noexcept
+  {
+    if (this->m_access != file_access::read_write)
+      return BlobView();
+    return BlobView(this->m_data, this->m_size);
+  }
+
+  bool FileBlob::try_open(char const* path, file_access access, file_options const& options) noexcept
+  {
+    this->close();
+
+    int const fd = ::open(path, (access == file_access::read_write) ? O_RDWR : O_RDONLY);
+    if (fd < 0)
+      return false;
+
+    struct stat info;
+    if (::fstat(fd, &info) != 0)
+    {
+      int const error_number = errno;
+      ::close(fd);
+      errno = error_number;
+      return false;
+    }
+
+    std::size_t const size = static_cast<std::size_t>(info.st_size);
+    void*             data = nullptr;
+    if (size != 0)
+    {
+      int const protection = (access == file_access::read_write) ? (PROT_READ | PROT_WRITE) : PROT_READ;
+      int       flags      = MAP_SHARED;
+#if defined(MAP_POPULATE)
+      if (options.populate)
+        flags |= MAP_POPULATE;
+#endif
+      data = ::mmap(nullptr, size, protection, flags, fd, 0);
+      if (data == MAP_FAILED)
+      {
+        int const error_number = errno;
+        ::close(fd);
+        errno = error_number;
+        return false;
+      }
+#if defined(MADV_HUGEPAGE)
+      if (options.huge_pages)
+        ::madvise(data, size, MADV_HUGEPAGE);
+#endif
+    }
+
+    this->m_data   = static_cast<std::byte*>(data);
+    this->m_size   = size;
+    this->m_fd     = fd;
+    this->m_access = access;
+    return true;
+  }
+
+  bool FileBlob::try_advise(std::size_t const& offset, std::size_t const& number_of_bytes, file_advice advice) noexcept
+  {
+    if (this->m_size < (offset + number_of_bytes))
+    {
+      errno = EINVAL;
+      return false;
+    }
+    if (number_of_bytes == 0)
+      return true;
+
+    std::size_t const page  = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    std::size_t const begin = offset - (offset % page);
+    return ::madvise(this->m_data + begin, offset + number_of_bytes - begin, to_madvise(advice)) == 0;
+  }
+
+  bool FileBlob::try_sync(std::size_t const& offset, std::size_t const& number_of_bytes, bool wait) noexcept
+  {
+    if (this->m_size < (offset + number_of_bytes))
+    {
+      errno = EINVAL;
+      return false;
+    }
+    if ((number_of_bytes == 0) || (this->m_access != file_access::read_write))
+      return true;
+
+    std::size_t const page  = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    std::size_t const begin = offset - (offset % page);
+    return ::msync(this->m_data + begin, offset + number_of_bytes - begin, wait ? MS_SYNC : MS_ASYNC) == 0;
+  }
+
+  void FileBlob::close() noexcept
+  {
+    if (this->m_data != nullptr)
+      ::munmap(this->m_data, this->m_size);
+    if (this->m_fd >= 0)
+      ::close(this->m_fd);
+
+    this->m_data = nullptr;
+    this->m_size = 0;
+    this->m_fd   = -1;
+  }
+
+  void FileBlob::open(char const* path, file_access access, file_options const& options)
+  {
+    if (!this->try_open(path, access, options))
+      return error::handle_file_exception();
+  }
+
+  void FileBlob::advise(file_advice advice)
+  {
+    if (!this->try_advise(advice))
+      return error::handle_file_exception();
+  }
+
+  void FileBlob::sync(bool wait)
+  {
+    if (!this->try_sync(wait))
+      return error::handle_file_exception();
+  }
+}    // namespace wlib::blob
+#endif
@@ -0,0 +1,126 @@
+#include <wlib-BLOB_IO.hpp>
+
+#if defined(WLIB_BLOB_FILE_MAPPING)
+//
+#include <cerrno>
+
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace wlib::blob::io
+{
+  namespace
+  {
+    constexpr std::size_t max_vectors = 64;
+
+    // Fills vec from the buffers starting at buffer_idx/inner_idx, returns the number of vectors used.
+    template <typename Tbuffer> std::size_t fill_vectors(iovec (&vec)[max_vectors], std::span<Tbuffer const> const& buffers, std::size_t buffer_idx, std::size_t inner_idx)
+    {
+      std::size_t count = 0;
+      for (; (buffer_idx < buffers.size()) && (count < max_vectors); buffer_idx++)
+      {
+        if (buffers[buffer_idx].size() == inner_idx)
+        {
+          inner_idx = 0;
+          continue;
+        }
+        vec[count].iov_base = const_cast<std::byte*>(buffers[buffer_idx].data() + inner_idx);
+        vec[count].iov_len  = buffers[buffer_idx].size() - inner_idx;
+        count++;
+        inner_idx = 0;
+      }
+      return count;
+    }
+
+    template <typename Tbuffer> void skip(std::span<Tbuffer const> const& buffers, std::size_t& buffer_idx, std::size_t& inner_idx, std::size_t number_of_bytes)
+    {
+      while ((buffer_idx < buffers.size()) && (number_of_bytes >= (buffers[buffer_idx].size() - inner_idx)))
+      {
+        number_of_bytes -= buffers[buffer_idx].size() - inner_idx;
+        inner_idx = 0;
+        buffer_idx++;
+      }
+      inner_idx += number_of_bytes;
+    }
+
+    template <typename Tio> bool write_all(std::span<std::span<std::byte const> const> const& buffers, std::size_t& offset, Tio&& io) noexcept
+    {
+      std::size_t buffer_idx = 0;
+      std::size_t inner_idx  = 0;
+      iovec       vec[max_vectors];
+
+      offset = 0;
+      for (std::size_t count = fill_vectors(vec, buffers, buffer_idx, inner_idx); count != 0; count = fill_vectors(vec, buffers, buffer_idx, inner_idx))
+      {
+        ssize_t const ret = io(vec, static_cast<int>(count), offset);
+        if (ret < 0)
+        {
+          if (errno == EINTR)
+            continue;
+          return false;
+        }
+        if (ret == 0)
+        {
+          errno = EIO;
+          return false;
+        }
+        offset += static_cast<std::size_t>(ret);
+        skip(buffers, buffer_idx, inner_idx, static_cast<std::size_t>(ret));
+      }
+      return true;
+    }
+  }    // namespace
+
+  bool try_writev(int fd, std::span<std::span<std::byte const> const> const& buffers, std::size_t& number_of_bytes) noexcept
+  {
+    return write_all(buffers, number_of_bytes, [fd](iovec const* vec, int count, std::size_t) { return ::writev(fd, vec, count); });
+  }
+
+  bool try_pwritev(int fd, std::size_t const& offset, std::span<std::span<std::byte const> const> const& buffers, std::size_t& number_of_bytes) noexcept
+  {
+    return write_all(buffers, number_of_bytes, [fd, &offset](iovec const* vec, int count, std::size_t written) {
+      return ::pwritev(fd, vec, count, static_cast<off_t>(offset + written));
+    });
+  }
+
+  bool try_writev(int fd, std::span<std::span<std::byte const> const> const& buffers) noexcept
+  {
+    std::size_t number_of_bytes = 0;
+    return io::try_writev(fd, buffers, number_of_bytes);
+  }
+
+  bool try_pwritev(int fd, std::size_t const& offset, std::span<std::span<std::byte const> const> const& buffers) noexcept
+  {
+    std::size_t number_of_bytes = 0;
+    return io::try_pwritev(fd, offset, buffers, number_of_bytes);
+  }
+
+  bool try_readv(int fd, std::span<std::span<std::byte> const> const& buffers, std::size_t& number_of_bytes) noexcept
+  {
+    std::size_t buffer_idx = 0;
+    std::size_t inner_idx  = 0;
+    iovec       vec[max_vectors];
+
+    number_of_bytes = 0;
+    for (std::size_t count = fill_vectors(vec, buffers, buffer_idx, inner_idx); count != 0; count = fill_vectors(vec, buffers, buffer_idx, inner_idx))
+    {
+      ssize_t const ret = ::readv(fd, vec, static_cast<int>(count));
+      if (ret < 0)
+      {
+        if (errno == EINTR)
+          continue;
+        // A non-blocking descriptor without more data ends the read once something has arrived.
+        if (((errno == EAGAIN) || (errno == EWOULDBLOCK)) && (number_of_bytes != 0))
+          break;
+        return false;
+      }
+      if (ret == 0)
+        break;
+      number_of_bytes += static_cast<std::size_t>(ret);
+      skip(buffers, buffer_idx, inner_idx, static_cast<std::size_t>(ret));
+    }
+    return true;
+  }
+}    // namespace wlib::blob::io
+#endif
@@ -0,0 +1,294 @@
+#include <wlib-BLOB_LZ.hpp>
+
+//
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+namespace wlib::blob::lz
+{
+  namespace
+  {
+    constexpr std::size_t hash_bits     = 12;
+    constexpr std::size_t hash_size     = std::size_t(1) << hash_bits;
+    constexpr std::size_t min_match     = 4;
+    constexpr std::size_t last_literals = 5;     // the block always ends with literals
+    constexpr std::size_t match_limit   = 12;    // no match may start within the last bytes
+    constexpr std::size_t max_offset    = 65535;
+    constexpr std::size_t history_size  = 2 * window_size + max_block_size;
+
+    inline std::uint32_t read32(std::byte const* src) noexcept
+    {
+      std::uint32_t value;
+      std::memcpy(&value, src, sizeof(value));
+      return value;
+    }
+    inline std::uint64_t read64(std::byte const* src) noexcept
+    {
+      std::uint64_t value;
+      std::memcpy(&value, src, sizeof(value));
+      return value;
+    }
+    inline std::size_t hash(std::uint32_t const& value) noexcept { return (value * 2654435761u) >> (32 - hash_bits); }
+
+    // Number of equal bytes of a and b, a stops at limit.
+    std::size_t count_equal(std::byte const* a, std::byte const* b, std::byte const* limit) noexcept
+    {
+      std::byte const* const start = a;
+      while (a + sizeof(std::uint64_t) <= limit)
+      {
+        if (std::uint64_t const diff = read64(a) ^ read64(b); diff != 0)
+        {
+          if constexpr (std::endian::native == std::endian::little)
+            return static_cast<std::size_t>(a - start) + static_cast<std::size_t>(std::countr_zero(diff)) / 8;
+          else
+            return static_cast<std::size_t>(a - start) + static_cast<std::size_t>(std::countl_zero(diff)) / 8;
+        }
+        a += sizeof(std::uint64_t);
+        b += sizeof(std::uint64_t);
+      }
+      while ((a < limit) && (*a == *b))
+      {
+        a++;
+        b++;
+      }
+      return static_cast<std::size_t>(a - start);
+    }
+
+    constexpr std::size_t extra_length_size(std::size_t const& length) noexcept { return (length < 15) ? 0 : ((length - 15) / 255 + 1); }
+
+    inline void write_extra_length(std::byte*& op, std::size_t length) noexcept
+    {
+      for (length -= 15; length >= 255; length -= 255)
+        *op++ = std::byte(255);
+      *op++ = static_cast<std::byte>(length);
+    }
+
+    bool read_extra_length(std::byte const*& ip, std::byte const* end, std::size_t& length) noexcept
+    {
+      for (;;)
+      {
+        if (ip == end)
+          return false;
+        std::size_t const value = static_cast<std::size_t>(*ip++);
+        length += value;
+        if (value != 255)
+          return true;
+      }
+    }
+
+    bool write_literals(std::byte*& op, std::byte const* end, std::byte const* literals, std::size_t const& number_of_literals, std::size_t const& reserve,
+                        std::uint8_t const& match_token) noexcept
+    {
+      if (static_cast<std::size_t>(end - op) < (1 + extra_length_size(number_of_literals) + number_of_literals + reserve))
+        return false;
+
+      *op++ = static_cast<std::byte>((std::min<std::size_t>(number_of_literals, 15) << 4) | match_token);
+      if (number_of_literals >= 15)
+        write_extra_length(op, number_of_literals);
+      if (number_of_literals != 0)
+        std::memcpy(op, literals, number_of_literals);
+      op += number_of_literals;
+      return true;
+    }
+
+    bool write_sequence(std::byte*& op, std::byte const* end, std::byte const* literals, std::size_t const& number_of_literals, std::size_t const& offset,
+                        std::size_t const& length) noexcept
+    {
+      std::size_t const match = length - min_match;
+      if (!write_literals(op, end, literals, number_of_literals, 2 + extra_length_size(match), static_cast<std::uint8_t>(std::min<std::size_t>(match, 15))))
+        return false;
+      *op++ = static_cast<std::byte>(offset & 0xFF);
+      *op++ = static_cast<std::byte>(offset >> 8);
+      if (match >= 15)
+        write_extra_length(op, match);
+      return true;
+    }
+
+    // Compresses base[begin, end), matches may start at dict_begin. table holds positions relative to base.
+    std::size_t compress_block(std::byte* dst, std::size_t const& capacity, std::byte const* base, std::size_t const& dict_begin, std::size_t const& begin,
+                               std::size_t const& end, std::uint32_t* table) noexcept
+    {
+      std::byte*             op     = dst;
+      std::byte const* const op_end = dst + capacity;
+      std::size_t            anchor = begin;
+
+      if ((end - begin) > match_limit)
+      {
+        std::size_t const      limit      = end - match_limit;
+        std::byte const* const match_stop = base + end - last_literals;
+        std::size_t            ip         = begin;
+        while (ip < limit)
+        {
+          std::uint32_t const sequence = read32(base + ip);
+          std::size_t const   h        = hash(sequence);
+          std::size_t         match    = table[h];
+          table[h]                     = static_cast<std::uint32_t>(ip);
+
+          if ((dict_begin <= match) && (match < ip) && ((ip - match) <= max_offset) && (read32(base + match) == sequence))
+          {
+            while ((anchor < ip) && (dict_begin < match) && (base[ip - 1] == base[match - 1]))
+            {
+              ip--;
+              match--;
+            }
+            std::size_t const length = min_match + count_equal(base + ip + min_match, base + match + min_match, match_stop);
+            if (!write_sequence(op, op_end, base + anchor, ip - anchor, ip - match, length))
+              return 0;
+
+            ip += length;
+            anchor = ip;
+            if (ip < limit)
+              table[hash(read32(base + ip - 2))] = static_cast<std::uint32_t>(ip - 2);
+            continue;
+          }
+          // Step faster through data which does not compress.
+          ip += 1 + ((ip - anchor) >> 6);
+        }
+      }
+
+      if (!write_literals(op, op_end, base + anchor, end - anchor, 0, 0))
+        return 0;
+      return static_cast<std::size_t>(op - dst);
+    }
+
+    // Decodes into dst, matches may reach back to history.
+    bool decompress_block(std::byte const* history, std::byte* dst, std::size_t const& capacity, std::byte const* src, std::size_t const& number_of_bytes,
+                          std::size_t& decompressed_number_of_bytes) noexcept
+    {
+      std::byte const*       ip     = src;
+      std::byte const* const ip_end = src + number_of_bytes;
+      std::byte*             op     = dst;
+      std::byte const* const op_end = dst + capacity;
+      if (number_of_bytes == 0)
+        return false;
+
+      for (;;)
+      {
+        std::size_t const token    = static_cast<std::size_t>(*ip++);
+        std::size_t       literals = token >> 4;
+        if ((literals == 15) && !read_extra_length(ip, ip_end, literals))
+          return false;
+        if ((static_cast<std::size_t>(ip_end - ip) < literals) || (static_cast<std::size_t>(op_end - op) < literals))
+          return false;
+        // Short runs are copied as one fixed 16 byte move while there is slack on both sides.
+        if ((literals <= 16) && ((ip_end - ip) >= 16) && ((op_end - op) >= 16))
+          std::memcpy(op, ip, 16);
+        else if (literals != 0)
+          std::memcpy(op, ip, literals);
+        op += literals;
+        ip += literals;
+        if (ip == ip_end)
+          break;
+
+        if ((ip_end - ip) < 2)
+          return false;
+        std::size_t const offset = static_cast<std::size_t>(ip[0]) | (static_cast<std::size_t>(ip[1]) << 8);
+        ip += 2;
+        if ((offset == 0) || (static_cast<std::size_t>(op - history) < offset))
+          return false;
+
+        std::size_t length = token & 0x0F;
+        if ((length == 15) && !read_extra_length(ip, ip_end, length))
+          return false;
+        length += min_match;
+        if (static_cast<std::size_t>(op_end - op) < length)
+          return false;
+
+        std::byte const* match = op - offset;
+        if ((offset >= 8) && (static_cast<std::size_t>(op_end - op) >= (length + 8)))
+        {
+          // Word copies may overlap the match as long as each word was written before it is read.
+          for (std::size_t idx = 0; idx < length; idx += 8)
+            std::memcpy(op + idx, match + idx, 8);
+          op += length;
+        }
+        else
+        {
+          for (std::size_t idx = 0; idx < length; idx++)
+            *op++ = *match++;
+        }
+        if (ip == ip_end)
+          return false;
+      }
+      decompressed_number_of_bytes = static_cast<std::size_t>(op - dst);
+      return true;
+    }
+  }    // namespace
+
+  std::size_t compress(std::byte* dst, std::size_t const& capacity, std::byte const* src, std::size_t const& number_of_bytes) noexcept
+  {
+    std::uint32_t table[hash_size]{};
+    return compress_block(dst, capacity, src, 0, 0, number_of_bytes, table);
+  }
+
+  bool decompress(std::byte* dst, std::size_t const& capacity, std::byte const* src, std::size_t const& number_of_bytes, std::size_t& decompressed_number_of_bytes) noexcept
+  {
+    return decompress_block(dst, dst, capacity, src, number_of_bytes, decompressed_number_of_bytes);
+  }
+
+  StreamEncoder::StreamEncoder()
+      : m_history(std::make_unique<std::byte[]>(history_size))
+      , m_table(std::make_unique<std::uint32_t[]>(hash_size))
+  {
+  }
+
+  void StreamEncoder::reset() noexcept
+  {
+    std::fill_n(this->m_table.get(), hash_size, 0);
+    this->m_pos = 0;
+  }
+
+  bool StreamEncoder::try_compress(std::byte* dst, std::size_t const& capacity, std::span<std::byte const> const& src, std::size_t& number_of_bytes) noexcept
+  {
+    if (max_block_size < src.size())
+      return false;
+
+    // Keep the last window in front and rebase the hash table on it.
+    if (history_size < (this->m_pos + src.size()))
+    {
+      std::size_t const keep  = std::min(this->m_pos, window_size);
+      std::size_t const shift = this->m_pos - keep;
+      std::memmove(this->m_history.get(), this->m_history.get() + shift, keep);
+      for (std::size_t idx = 0; idx < hash_size; idx++)
+        this->m_table[idx] = (this->m_table[idx] >= shift) ? static_cast<std::uint32_t>(this->m_table[idx] - shift) : 0;
+      this->m_pos = keep;
+    }
+
+    if (!src.empty())
+      std::memcpy(this->m_history.get() + this->m_pos, src.data(), src.size());
+    std::size_t const dict_begin = (this->m_pos > window_size) ? (this->m_pos - window_size) : 0;
+    std::size_t const result     = compress_block(dst, capacity, this->m_history.get(), dict_begin, this->m_pos, this->m_pos + src.size(), this->m_table.get());
+    if (result == 0)
+      return false;
+
+    this->m_pos += src.size();
+    number_of_bytes = result;
+    return true;
+  }
+
+  StreamDecoder::StreamDecoder()
+      : m_history(std::make_unique<std::byte[]>(history_size))
+  {
+  }
+
+  bool StreamDecoder::try_decompress(std::byte* dst, std::size_t const& capacity, std::span<std::byte const> const& src, std::size_t& number_of_bytes) noexcept
+  {
+    if (history_size < (this->m_pos + max_block_size))
+    {
+      std::size_t const keep = std::min(this->m_pos, window_size);
+      std::memmove(this->m_history.get(), this->m_history.get() + this->m_pos - keep, keep);
+      this->m_pos = keep;
+    }
+
+    std::size_t result = 0;
+    if (!decompress_block(this->m_history.get(), this->m_history.get() + this->m_pos, std::min(capacity, max_block_size), src.data(), src.size(), result))
+      return false;
+
+    if (result != 0)
+      std::memcpy(dst, this->m_history.get() + this->m_pos, result);
+    this->m_pos += result;
+    number_of_bytes = result;
+    return true;
+  }
+}    // namespace wlib::blob::lz
@@ -0,0 +1,172 @@
+#include <wlib-BLOB_Pool.hpp>
+
+//
+#include <new>
+#include <utility>
+
+namespace wlib::blob
+{
+  namespace
+  {
+    constexpr std::uint32_t empty = UINT32_MAX;
+
+    constexpr std::uint64_t make_head(std::uint64_t const& tag, std::uint32_t const& slot) noexcept { return (tag << 32) | slot; }
+
+    std::size_t thread_index() noexcept
+    {
+      static std::atomic<std::size_t> next_index{ 0 };
+      thread_local std::size_t const  index = next_index.fetch_add(1, std::memory_order_relaxed);
+      return index;
+    }
+
+    void raise_to(std::atomic<std::size_t>& peak, std::size_t const& value) noexcept
+    {
+      std::size_t current = peak.load(std::memory_order_relaxed);
+      while ((current < value) && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed))
+      {
+      }
+    }
+  }    // namespace
+
+  PooledBlob::PooledBlob(PooledBlob&& other) noexcept
+      : MemoryBlob(static_cast<MemoryBlob const&>(other))
+      , m_pool(std::exchange(other.m_pool, nullptr))
+      , m_buffer(std::exchange(other.m_buffer, nullptr))
+      , m_slot(std::exchange(other.m_slot, no_slot))
+      , m_owner(other.m_owner)
+  {
+    static_cast<MemoryBlob&>(other) = MemoryBlob(nullptr, std::size_t(0));
+  }
+
+  PooledBlob& PooledBlob::operator=(PooledBlob&& other) noexcept
+  {
+    if (this != &other)
+    {
+      this->release();
+      static_cast<MemoryBlob&>(*this) = static_cast<MemoryBlob const&>(other);
+      static_cast<MemoryBlob&>(other) = MemoryBlob(nullptr, std::size_t(0));
+      this->m_pool                    = std::exchange(other.m_pool, nullptr);
+      this->m_buffer                  = std::exchange(other.m_buffer, nullptr);
+      this->m_slot                    = std::exchange(other.m_slot, no_slot);
+      this->m_owner                   = other.m_owner;
+    }
+    return *this;
+  }
+
+  void PooledBlob::release() noexcept
+  {
+    if (this->m_pool == nullptr)
+      return;
+
+    this->m_pool->release(*this);
+    static_cast<MemoryBlob&>(*this) = MemoryBlob(nullptr, std::size_t(0));
+    this->m_pool                    = nullptr;
+    this->m_buffer                  = nullptr;
+    this->m_slot                    = no_slot;
+  }
+
+  BlobPool::BlobPool(std::size_t const& buffer_size, std::size_t const& number_of_buffers)
+      : m_buffer_size(buffer_size)
+      , m_stride((buffer_size + alignment - 1) / alignment * alignment)
+      , m_number_of_buffers((number_of_buffers < empty) ? number_of_buffers : 0)
+      , m_head(make_head(0, empty))
+  {
+    if (number_of_buffers >= empty)
+      error::handle_insert_exception();
+
+    std::size_t const count = this->m_number_of_buffers;
+    this->m_slab.reset(static_cast<std::byte*>(::operator new[](this->m_stride * count, std::align_val_t(alignment))));
+    this->m_next = std::make_unique<std::atomic<std::uint32_t>[]>(count);
+    for (std::size_t idx = 0; idx < count; idx++)
+      this->m_next[idx].store((idx + 1 < count) ? static_cast<std::uint32_t>(idx + 1) : empty, std::memory_order_relaxed);
+    this->m_head.store(make_head(0, (count != 0) ? 0 : empty), std::memory_order_release);
+  }
+
+  pool_statistics BlobPool::get_statistics() const noexcept
+  {
+    pool_statistics statistics;
+    std::size_t     releases = 0;
+    for (counter_shard const& shard : this->m_shards)
+    {
+      statistics.acquisitions += shard.acquisitions.load(std::memory_order_relaxed);
+      statistics.cross_thread_releases += shard.cross_thread_releases.load(std::memory_order_relaxed);
+      releases += shard.releases.load(std::memory_order_relaxed);
+    }
+
+    std::size_t const heap_peak = this->m_heap_high_water_mark.load(std::memory_order_relaxed);
+    statistics.capacity         = this->m_number_of_buffers;
+    statistics.in_use           = (statistics.acquisitions > releases) ? (statistics.acquisitions - releases) : 0;
+    statistics.high_water_mark  = (heap_peak != 0) ? (this->m_number_of_buffers + heap_peak) : this->m_touched.load(std::memory_order_relaxed);
+    statistics.misses           = this->m_misses.load(std::memory_order_relaxed);
+    return statistics;
+  }
+
+  bool BlobPool::try_pop(std::uint32_t& slot) noexcept
+  {
+    std::uint64_t head = this->m_head.load(std::memory_order_acquire);
+    for (;;)
+    {
+      slot = static_cast<std::uint32_t>(head);
+      if (slot == empty)
+        return false;
+
+      std::uint64_t const next = make_head((head >> 32) + 1, this->m_next[slot].load(std::memory_order_relaxed));
+      if (this->m_head.compare_exchange_weak(head, next, std::memory_order_acquire, std::memory_order_acquire))
+        return true;
+    }
+  }
+
+  void BlobPool::push(std::uint32_t const& slot) noexcept
+  {
+    std::uint64_t head = this->m_head.load(std::memory_order_relaxed);
+    for (;;)
+    {
+      this->m_next[slot].store(static_cast<std::uint32_t>(head), std::memory_order_relaxed);
+      if (this->m_head.compare_exchange_weak(head, make_head((head >> 32) + 1, slot), std::memory_order_release, std::memory_order_relaxed))
+        return;
+    }
+  }
+
+  BlobPool::counter_shard& BlobPool::get_shard() noexcept { return this->m_shards[thread_index() % number_of_shards]; }
+
+  bool BlobPool::try_acquire(PooledBlob& blob) noexcept
+  {
+    std::uint32_t slot;
+    if (!this->try_pop(slot))
+      return false;
+
+    raise_to(this->m_touched, std::size_t(slot) + 1);
+    this->get_shard().acquisitions.fetch_add(1, std::memory_order_relaxed);
+    blob = PooledBlob(this, this->m_slab.get() + slot * this->m_stride, this->m_buffer_size, slot);
+    return true;
+  }
+
+  PooledBlob BlobPool::acquire()
+  {
+    PooledBlob blob;
+    if (this->try_acquire(blob))
+      return blob;
+
+    std::byte* const buffer = static_cast<std::byte*>(::operator new[](this->m_stride, std::align_val_t(alignment)));
+    this->m_misses.fetch_add(1, std::memory_order_relaxed);
+    raise_to(this->m_heap_high_water_mark, this->m_heap_in_use.fetch_add(1, std::memory_order_relaxed) + 1);
+    this->get_shard().acquisitions.fetch_add(1, std::memory_order_relaxed);
+    return PooledBlob(this, buffer, this->m_buffer_size, PooledBlob::no_slot);
+  }
+
+  void BlobPool::release(PooledBlob& blob) noexcept
+  {
+    counter_shard& shard = this->get_shard();
+    if (blob.m_owner != std::this_thread::get_id())
+      shard.cross_thread_releases.fetch_add(1, std::memory_order_relaxed);
+    shard.releases.fetch_add(1, std::memory_order_relaxed);
+
+    if (blob.m_slot == PooledBlob::no_slot)
+    {
+      ::operator delete[](blob.m_buffer, std::align_val_t(alignment));
+      this->m_heap_in_use.fetch_sub(1, std::memory_order_relaxed);
+    }
+    else
+      this->push(blob.m_slot);
+  }
+}    // namespace wlib::blob
@@ -0,0 +1,245 @@
+#include <wlib-BLOB_Search.hpp>
+
+//
+#include <bit>
+#include <cstring>
+
+#include "wlib-BLOB_Cpu.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define WLIB_BLOB_SEARCH_SSE2 1
+#endif
+
+namespace wlib::blob
+{
+  namespace
+  {
+#if defined(WLIB_BLOB_SEARCH_SSE2)
+    constexpr std::size_t vector_size = 16;
+    using vector_t                    = __m128i;
+
+    inline vector_t      splat(std::byte const& value) noexcept { return _mm_set1_epi8(static_cast<char>(value)); }
+    inline std::uint32_t match(std::byte const* src, vector_t const& value) noexcept
+    {
+      return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(src)), value)));
+    }
+#endif
+
+    // Beyond this many set bytes a lookup table beats one compare per set byte.
+    constexpr std::size_t max_vector_set = 8;
+
+#if defined(WLIB_BLOB_CPU_AVX2)
+    // The AVX2 kernels scan whole 32 byte blocks from idx. On a hit idx is the match, otherwise the
+    // first byte left for the SSE2 and scalar loops.
+    constexpr std::size_t avx2_vector_size = 32;
+
+    WLIB_BLOB_AVX2_TARGET inline __m256i splat_avx2(std::byte const& value) noexcept { return _mm256_set1_epi8(static_cast<char>(value)); }
+    WLIB_BLOB_AVX2_TARGET inline std::uint32_t match_avx2(std::byte const* src, __m256i const& value) noexcept
+    {
+      return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(src)), value)));
+    }
+
+    WLIB_BLOB_AVX2_TARGET bool find_avx2(std::byte const* src, std::size_t const& size, std::byte const& value, std::size_t& idx) noexcept
+    {
+      __m256i const needle = splat_avx2(value);
+      for (; idx + avx2_vector_size <= size; idx += avx2_vector_size)
+      {
+        if (std::uint32_t const mask = match_avx2(src + idx, needle); mask != 0)
+        {
+          idx += static_cast<std::size_t>(std::countr_zero(mask));
+          return true;
+        }
+      }
+      return false;
+    }
+
+    WLIB_BLOB_AVX2_TARGET bool find_any_of_avx2(std::byte const* src, std::size_t const& size, std::span<std::byte const> const& set, std::size_t& idx) noexcept
+    {
+      __m256i needles[max_vector_set];
+      for (std::size_t i = 0; i < set.size(); i++)
+        needles[i] = splat_avx2(set[i]);
+
+      for (; idx + avx2_vector_size <= size; idx += avx2_vector_size)
+      {
+        std::uint32_t mask = 0;
+        for (std::size_t i = 0; i < set.size(); i++)
+          mask |= match_avx2(src + idx, needles[i]);
+        if (mask != 0)
+        {
+          idx += static_cast<std::size_t>(std::countr_zero(mask));
+          return true;
+        }
+      }
+      return false;
+    }
+
+    // end is the number of candidate start positions, last the index of the last pattern byte.
+    WLIB_BLOB_AVX2_TARGET bool find_pattern_avx2(std::byte const* src, std::size_t const& end, std::span<std::byte const> const& pattern, std::size_t const& last,
+                                                 std::size_t& idx) noexcept
+    {
+      __m256i const first_needle = splat_avx2(pattern[0]);
+      __m256i const last_needle  = splat_avx2(pattern[last]);
+      for (; idx + avx2_vector_size <= end; idx += avx2_vector_size)
+      {
+        std::uint32_t mask = match_avx2(src + idx, first_needle) & match_avx2(src + idx + last, last_needle);
+        while (mask != 0)
+        {
+          std::size_t const candidate = idx + static_cast<std::size_t>(std::countr_zero(mask));
+          if (std::memcmp(src + candidate + 1, pattern.data() + 1, last - 1) == 0)
+          {
+            idx = candidate;
+            return true;
+          }
+          mask &= mask - 1;
+        }
+      }
+      return false;
+    }
+
+    WLIB_BLOB_AVX2_TARGET std::size_t count_avx2(std::byte const* src, std::size_t const& size, std::byte const& value, std::size_t& idx) noexcept
+    {
+      __m256i const needle = splat_avx2(value);
+      std::size_t   result = 0;
+      for (; idx + avx2_vector_size <= size; idx += avx2_vector_size)
+        result += static_cast<std::size_t>(std::popcount(match_avx2(src + idx, needle)));
+      return result;
+    }
+#endif
+
+    std::size_t find_any_of_table(std::byte const* data, std::size_t const& size, std::span<std::byte const> const& set) noexcept
+    {
+      bool table[256]{};
+      for (std::byte const value : set)
+        table[static_cast<std::uint8_t>(value)] = true;
+      for (std::size_t idx = 0; idx < size; idx++)
+      {
+        if (table[static_cast<std::uint8_t>(data[idx])])
+          return idx;
+      }
+      return npos;
+    }
+  }    // namespace
+
+  std::size_t find(std::span<std::byte const> const& data, std::byte const& value) noexcept
+  {
+#if defined(WLIB_BLOB_SEARCH_SSE2)
+    std::byte const* const src = data.data();
+    std::size_t            idx = 0;
+#if defined(WLIB_BLOB_CPU_AVX2)
+    if (cpu::has_avx2() && find_avx2(src, data.size(), value, idx))
+      return idx;
+#endif
+    vector_t const needle = splat(value);
+    for (; idx + vector_size <= data.size(); idx += vector_size)
+    {
+      if (std::uint32_t const mask = match(src + idx, needle); mask != 0)
+        return idx + static_cast<std::size_t>(std::countr_zero(mask));
+    }
+    for (; idx < data.size(); idx++)
+    {
+      if (src[idx] == value)
+        return idx;
+    }
+    return npos;
+#else
+    if (data.empty())
+      return npos;
+    void const* const hit = std::memchr(data.data(), static_cast<int>(value), data.size());
+    return (hit == nullptr) ? npos : static_cast<std::size_t>(static_cast<std::byte const*>(hit) - data.data());
+#endif
+  }
+
+  std::size_t find_any_of(std::span<std::byte const> const& data, std::span<std::byte const> const& set) noexcept
+  {
+    if (set.size() == 1)
+      return wlib::blob::find(data, set[0]);
+#if defined(WLIB_BLOB_SEARCH_SSE2)
+    if (set.empty() || (max_vector_set < set.size()))
+      return set.empty() ? npos : find_any_of_table(data.data(), data.size(), set);
+
+    std::byte const* const src = data.data();
+    std::size_t            idx = 0;
+#if defined(WLIB_BLOB_CPU_AVX2)
+    if (cpu::has_avx2() && find_any_of_avx2(src, data.size(), set, idx))
+      return idx;
+#endif
+    vector_t needles[max_vector_set];
+    for (std::size_t i = 0; i < set.size(); i++)
+      needles[i] = splat(set[i]);
+
+    for (; idx + vector_size <= data.size(); idx += vector_size)
+    {
+      std::uint32_t mask = 0;
+      for (std::size_t i = 0; i < set.size(); i++)
+        mask |= match(src + idx, needles[i]);
+      if (mask != 0)
+        return idx + static_cast<std::size_t>(std::countr_zero(mask));
+    }
+    std::size_t const tail = find_any_of_table(src + idx, data.size() - idx, set);
+    return (tail == npos) ? npos : idx + tail;
+#else
+    return set.empty() ? npos : find_any_of_table(data.data(), data.size(), set);
+#endif
+  }
+
+  std::size_t find(std::span<std::byte const> const& data, std::span<std::byte const> const& pattern) noexcept
+  {
+    if (pattern.empty())
+      return 0;
+    if (data.size() < pattern.size())
+      return npos;
+    if (pattern.size() == 1)
+      return wlib::blob::find(data, pattern[0]);
+
+    std::byte const* const src  = data.data();
+    std::size_t const      last = pattern.size() - 1;
+    std::size_t const      end  = data.size() - last;    // number of candidate start positions
+    std::size_t            idx  = 0;
+#if defined(WLIB_BLOB_CPU_AVX2)
+    if (cpu::has_avx2() && find_pattern_avx2(src, end, pattern, last, idx))
+      return idx;
+#endif
+#if defined(WLIB_BLOB_SEARCH_SSE2)
+    // Candidates must match the first and the last pattern byte, only those are compared fully.
+    vector_t const first_needle = splat(pattern[0]);
+    vector_t const last_needle  = splat(pattern[last]);
+    for (; idx + vector_size <= end; idx += vector_size)
+    {
+      std::uint32_t mask = match(src + idx, first_needle) & match(src + idx + last, last_needle);
+      while (mask != 0)
+      {
+        std::size_t const candidate = idx + static_cast<std::size_t>(std::countr_zero(mask));
+        if (std::memcmp(src + candidate + 1, pattern.data() + 1, last - 1) == 0)
+          return candidate;
+        mask &= mask - 1;
+      }
+    }
+#endif
+    for (; idx < end; idx++)
+    {
+      if ((src[idx] == pattern[0]) && (std::memcmp(src + idx + 1, pattern.data() + 1, last) == 0))
+        return idx;
+    }
+    return npos;
+  }
+
+  std::size_t count(std::span<std::byte const> const& data, std::byte const& value) noexcept
+  {
+    std::byte const* const src    = data.data();
+    std::size_t            result = 0;
+    std::size_t            idx    = 0;
+#if defined(WLIB_BLOB_CPU_AVX2)
+    if (cpu::has_avx2())
+      result = count_avx2(src, data.size(), value, idx);
+#endif
+#if defined(WLIB_BLOB_SEARCH_SSE2)
+    vector_t const needle = splat(value);
+    for (; idx + vector_size <= data.size(); idx += vector_size)
+      result += static_cast<std::size_t>(std::popcount(match(src + idx, needle)));
+#endif
+    for (; idx < data.size(); idx++)
+      result += (src[idx] == value) ? 1 : 0;
+    return result;
+  }
+}    // namespace wlib::blob
@@ -0,0 +1,237 @@
+#include <wlib-BLOB_Snapshot.hpp>
+
+//
+#include <cstring>
+#include <new>
+#include <utility>
+
+namespace wlib::blob
+{
+  namespace
+  {
+    std::size_t chunks_for(std::size_t const& number_of_bytes, std::size_t const& chunk_size) noexcept { return (number_of_bytes + chunk_size - 1) / chunk_size; }
+
+    void gather(cow_chunk* const* chunks, std::size_t const& chunk_size, std::size_t const& offset, std::byte* ptr, std::size_t const& number_of_bytes,
+                bool reverse) noexcept
+    {
+      std::size_t idx   = offset / chunk_size;
+      std::size_t inner = offset % chunk_size;
+      std::size_t done  = 0;
+      while (done < number_of_bytes)
+      {
+        std::size_t const step = ((chunk_size - inner) < (number_of_bytes - done)) ? (chunk_size - inner) : (number_of_bytes - done);
+        std::byte const*  src  = chunks[idx]->data() + inner;
+        if (reverse)
+        {
+          for (std::size_t i = 0; i < step; i++)
+            ptr[number_of_bytes - 1 - (done + i)] = src[i];
+        }
+        else
+        {
+          std::memcpy(ptr + done, src, step);
+        }
+        done += step;
+        inner = 0;
+        idx++;
+      }
+    }
+  }    // namespace
+
+  cow_chunk* cow_chunk::allocate(std::size_t const& chunk_size) noexcept
+  {
+    void* raw = ::operator new(sizeof(cow_chunk) + chunk_size, std::nothrow);
+    return (raw == nullptr) ? nullptr : new (raw) cow_chunk();
+  }
+
+  void cow_chunk::release(cow_chunk* chunk) noexcept
+  {
+    // The last owner sees all writes of the others through the acq_rel decrement.
+    if ((chunk != nullptr) && (chunk->references.fetch_sub(1, std::memory_order_acq_rel) == 1))
+    {
+      chunk->~cow_chunk();
+      ::operator delete(chunk);
+    }
+  }
+
+  BlobSnapshot::BlobSnapshot(BlobSnapshot const& other)
+      : m_chunks(std::make_unique<cow_chunk*[]>(other.m_number_of_chunks))
+      , m_number_of_chunks(other.m_number_of_chunks)
+      , m_chunk_size(other.m_chunk_size)
+      , m_used(other.m_used)
+  {
+    for (std::size_t idx = 0; idx < this->m_number_of_chunks; idx++)
+    {
+      this->m_chunks[idx] = other.m_chunks[idx];
+      this->m_chunks[idx]->references.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  BlobSnapshot& BlobSnapshot::operator=(BlobSnapshot const& other)
+  {
+    if (this != &other)
+      *this = BlobSnapshot(other);
+    return *this;
+  }
+
+  BlobSnapshot::BlobSnapshot(BlobSnapshot&& other) noexcept
+      : m_chunks(std::move(other.m_chunks))
+      , m_number_of_chunks(std::exchange(other.m_number_of_chunks, 0))
+      , m_chunk_size(std::exchange(other.m_chunk_size, 0))
+      , m_used(std::exchange(other.m_used, 0))
+  {
+  }
+
+  BlobSnapshot& BlobSnapshot::operator=(BlobSnapshot&& other) noexcept
+  {
+    if (this != &other)
+    {
+      this->reset();
+      this->m_chunks           = std::move(other.m_chunks);
+      this->m_number_of_chunks = std::exchange(other.m_number_of_chunks, 0);
+      this->m_chunk_size       = std::exchange(other.m_chunk_size, 0);
+      this->m_used             = std::exchange(other.m_used, 0);
+    }
+    return *this;
+  }
+
+  std::span<std::byte const> BlobSnapshot::get_chunk(std::size_t const& idx) const noexcept
+  {
+    if (this->m_number_of_chunks <= idx)
+      return {};
+    std::size_t const begin = idx * this->m_chunk_size;
+    std::size_t const size  = ((this->m_used - begin) < this->m_chunk_size) ? (this->m_used - begin) : this->m_chunk_size;
+    return std::span<std::byte const>(this->m_chunks[idx]->data(), size);
+  }
+
+  void BlobSnapshot::reset() noexcept
+  {
+    for (std::size_t idx = 0; idx < this->m_number_of_chunks; idx++)
+      cow_chunk::release(this->m_chunks[idx]);
+    this->m_chunks.reset();
+    this->m_number_of_chunks = 0;
+    this->m_used             = 0;
+  }
+
+  bool BlobSnapshot::try_read(std::size_t const& offset, std::byte* ptr, std::size_t const& number_of_bytes) const noexcept
+  {
+    if (this->m_used < (offset + number_of_bytes))
+      return false;
+    gather(this->m_chunks.get(), this->m_chunk_size, offset, ptr, number_of_bytes, false);
+    return true;
+  }
+
+  bool BlobSnapshot::try_read_reverse(std::size_t const& offset, std::byte* ptr, std::size_t const& number_of_bytes) const noexcept
+  {
+    if (this->m_used < (offset + number_of_bytes))
+      return false;
+    gather(this->m_chunks.get(), this->m_chunk_size, offset, ptr, number_of_bytes, true);
+    return true;
+  }
+
+  CowBlob::CowBlob(std::size_t const& capacity, std::size_t const& chunk_size)
+      : m_capacity((chunk_size != 0) ? capacity : 0)
+      , m_chunk_size((chunk_size != 0) ? chunk_size : default_chunk_size)
+  {
+    if (chunk_size == 0)
+      error::handle_insert_exception();
+    this->m_chunks = std::make_unique<cow_chunk*[]>(chunks_for(capacity, chunk_size));
+  }
+
+  CowBlob::~CowBlob()
+  {
+    std::size_t const number_of_chunks = chunks_for(this->m_capacity, this->m_chunk_size);
+    for (std::size_t idx = 0; idx < number_of_chunks; idx++)
+      cow_chunk::release(this->m_chunks[idx]);
+  }
+
+  BlobSnapshot CowBlob::snapshot() const
+  {
+    BlobSnapshot result;
+    result.m_number_of_chunks = chunks_for(this->m_used, this->m_chunk_size);
+    result.m_chunks           = std::make_unique<cow_chunk*[]>(result.m_number_of_chunks);
+    result.m_chunk_size       = this->m_chunk_size;
+    result.m_used             = this->m_used;
+    for (std::size_t idx = 0; idx < result.m_number_of_chunks; idx++)
+    {
+      result.m_chunks[idx] = this->m_chunks[idx];
+      result.m_chunks[idx]->references.fetch_add(1, std::memory_order_relaxed);
+    }
+    return result;
+  }
+
+  bool CowBlob::try_insert_back(std::byte const* begin, std::size_t const& number_of_bytes) noexcept
+  {
+    if (this->get_number_of_free_bytes() < number_of_bytes)
+      return false;
+    if (!this->try_write(this->m_used, begin, number_of_bytes))
+      return false;
+    this->m_used += number_of_bytes;
+    return true;
+  }
+
+  bool CowBlob::try_overwrite(std::size_t const& offset, std::byte const* begin, std::size_t const& number_of_bytes) noexcept
+  {
+    if (this->m_used < (offset + number_of_bytes))
+      return false;
+    return this->try_write(offset, begin, number_of_bytes);
+  }
+
+  bool CowBlob::try_read(std::size_t const& offset, std::byte* ptr, std::size_t const& number_of_bytes) const noexcept
+  {
+    if (this->m_used < (offset + number_of_bytes))
+      return false;
+    gather(this->m_chunks.get(), this->m_chunk_size, offset, ptr, number_of_bytes, false);
+    return true;
+  }
+
+  bool CowBlob::try_read_reverse(std::size_t const& offset, std::byte* ptr, std::size_t const& number_of_bytes) const noexcept
+  {
+    if (this->m_used < (offset + number_of_bytes))
+      return false;
+    gather(this->m_chunks.get(), this->m_chunk_size, offset, ptr, number_of_bytes, true);
+    return true;
+  }
+
+  bool CowBlob::try_write(std::size_t const& offset, std::byte const* begin, std::size_t const& number_of_bytes) noexcept
+  {
+    if (number_of_bytes == 0)
+      return true;
+
+    // Make every touched chunk exclusive first, so a failed allocation leaves the content unchanged.
+    std::size_t const first = offset / this->m_chunk_size;
+    std::size_t const last  = (offset + number_of_bytes - 1) / this->m_chunk_size;
+    for (std::size_t idx = first; idx <= last; idx++)
+    {
+      cow_chunk*& chunk = this->m_chunks[idx];
+      if ((chunk != nullptr) && (chunk->references.load(std::memory_order_acquire) == 1))
+        continue;
+
+      cow_chunk* const copy = cow_chunk::allocate(this->m_chunk_size);
+      if (copy == nullptr)
+        return false;
+      if (chunk != nullptr)
+      {
+        // Only the bytes in use are worth keeping.
+        std::size_t const chunk_begin = idx * this->m_chunk_size;
+        std::size_t const valid       = (this->m_used <= chunk_begin) ? 0 : (((this->m_used - chunk_begin) < this->m_chunk_size) ? (this->m_used - chunk_begin) : this->m_chunk_size);
+        std::memcpy(copy->data(), chunk->data(), valid);
+        cow_chunk::release(chunk);
+        this->m_chunk_copies += (valid != 0) ? 1 : 0;
+      }
+      chunk = copy;
+    }
+
+    std::size_t idx   = first;
+    std::size_t inner = offset % this->m_chunk_size;
+    std::size_t done  = 0;
+    while (done < number_of_bytes)
+    {
+      std::size_t const step = ((this->m_chunk_size - inner) < (number_of_bytes - done)) ? (this->m_chunk_size - inner) : (number_of_bytes - done);
+      std::memcpy(this->m_chunks[idx]->data() + inner, begin + done, step);
+      done += step;
+      inner = 0;
+      idx++;
+    }
+    return true;
+  }
+}    // namespace wlib::blob
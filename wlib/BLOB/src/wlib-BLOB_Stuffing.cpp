@@ -0,0 +1,134 @@
+#include <wlib-BLOB_Search.hpp>
+#include <wlib-BLOB_Stuffing.hpp>
+
+//
+#include <array>
+#include <cstring>
+
+namespace wlib::blob::cobs
+{
+  std::size_t encode(std::byte* dst, std::byte const* src, std::size_t const& number_of_bytes) noexcept
+  {
+    std::byte* const begin = dst;
+    std::size_t      left  = number_of_bytes;
+    for (;;)
+    {
+      std::size_t const run = (left < 254) ? left : 254;
+      std::size_t const idx = wlib::blob::find(std::span<std::byte const>(src, run), delimiter);
+      if (idx != npos)
+      {
+        // The zero is implied by the code byte, another block always follows.
+        *dst++ = static_cast<std::byte>(idx + 1);
+        std::memcpy(dst, src, idx);
+        dst += idx;
+        src += idx + 1;
+        left -= idx + 1;
+        continue;
+      }
+
+      *dst++ = static_cast<std::byte>(run + 1);
+      if (run != 0)
+        std::memcpy(dst, src, run);
+      dst += run;
+      src += run;
+      left -= run;
+      if ((run < 254) || (left == 0))
+        break;
+    }
+    *dst++ = delimiter;
+    return static_cast<std::size_t>(dst - begin);
+  }
+
+  bool decode(std::byte* dst, std::byte const* src, std::size_t const& number_of_bytes, std::size_t& decoded_number_of_bytes) noexcept
+  {
+    std::byte* const       begin = dst;
+    std::byte const* const end   = src + (((number_of_bytes != 0) && (src[number_of_bytes - 1] == delimiter)) ? number_of_bytes - 1 : number_of_bytes);
+    if (src == end)
+      return false;
+
+    while (src != end)
+    {
+      std::size_t const code = static_cast<std::size_t>(*src++);
+      if ((code == 0) || (static_cast<std::size_t>(end - src) < (code - 1)))
+        return false;
+      if (wlib::blob::find(std::span<std::byte const>(src, code - 1), delimiter) != npos)
+        return false;
+
+      // dst never overtakes src, so decoding in place only needs memmove.
+      std::memmove(dst, src, code - 1);
+      dst += code - 1;
+      src += code - 1;
+      if ((code != 0xFF) && (src != end))
+        *dst++ = std::byte(0);
+    }
+    decoded_number_of_bytes = static_cast<std::size_t>(dst - begin);
+    return true;
+  }
+}    // namespace wlib::blob::cobs
+
+namespace wlib::blob::slip
+{
+  namespace
+  {
+    constexpr std::array<std::byte, 2> special{ end, esc };
+  }    // namespace
+
+  std::size_t encode(std::byte* dst, std::byte const* src, std::size_t const& number_of_bytes) noexcept
+  {
+    std::byte* const begin = dst;
+    std::size_t      left  = number_of_bytes;
+    while (left != 0)
+    {
+      std::size_t idx = wlib::blob::find_any_of(std::span<std::byte const>(src, left), special);
+      if (idx == npos)
+        idx = left;
+      std::memcpy(dst, src, idx);
+      dst += idx;
+      src += idx;
+      left -= idx;
+      if (left != 0)
+      {
+        *dst++ = esc;
+        *dst++ = (*src++ == end) ? esc_end : esc_esc;
+        left--;
+      }
+    }
+    *dst++ = end;
+    return static_cast<std::size_t>(dst - begin);
+  }
+
+  bool decode(std::byte* dst, std::byte const* src, std::size_t const& number_of_bytes, std::size_t& decoded_number_of_bytes) noexcept
+  {
+    std::byte* const       begin = dst;
+    std::byte const* const last  = src + (((number_of_bytes != 0) && (src[number_of_bytes - 1] == end)) ? number_of_bytes - 1 : number_of_bytes);
+
+    // RFC 1055 senders may start a frame with END to flush line noise.
+    while ((src != last) && (*src == end))
+      src++;
+
+    while (src != last)
+    {
+      std::size_t idx = wlib::blob::find_any_of(std::span<std::byte const>(src, static_cast<std::size_t>(last - src)), special);
+      if (idx == npos)
+        idx = static_cast<std::size_t>(last - src);
+      std::memmove(dst, src, idx);
+      dst += idx;
+      src += idx;
+      if (src == last)
+        break;
+
+      // An END inside the frame or an unknown escape is malformed.
+      if ((*src == end) || ((last - src) < 2))
+        return false;
+      if (src[1] == esc_end)
+        *dst++ = end;
+      else if (src[1] == esc_esc)
+        *dst++ = esc;
+      else
+        return false;
+      src += 2;
+    }
+    decoded_number_of_bytes = static_cast<std::size_t>(dst - begin);
+    return true;
+  }
+}    // namespace wlib::blob::slip
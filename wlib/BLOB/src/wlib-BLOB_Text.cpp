@@ -0,0 +1,367 @@
+#include <wlib-BLOB_Text.hpp>
+
+//
+#include <array>
+#include <bit>
+#include <cstdint>
+
+#include "wlib-BLOB_Cpu.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define WLIB_BLOB_TEXT_SSE2 1
+#endif
+
+namespace wlib::blob
+{
+  namespace
+  {
+    constexpr char hex_lower[] = "0123456789abcdef";
+    constexpr char hex_upper[] = "0123456789ABCDEF";
+    constexpr char alphabet[]  = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    constexpr std::array<std::int8_t, 256> make_hex_table() noexcept
+    {
+      std::array<std::int8_t, 256> table{};
+      table.fill(-1);
+      for (int idx = 0; idx < 16; idx++)
+      {
+        table[static_cast<std::uint8_t>(hex_lower[idx])] = static_cast<std::int8_t>(idx);
+        table[static_cast<std::uint8_t>(hex_upper[idx])] = static_cast<std::int8_t>(idx);
+      }
+      return table;
+    }
+    constexpr std::array<std::int8_t, 256> make_base64_table() noexcept
+    {
+      std::array<std::int8_t, 256> table{};
+      table.fill(-1);
+      for (int idx = 0; idx < 64; idx++)
+        table[static_cast<std::uint8_t>(alphabet[idx])] = static_cast<std::int8_t>(idx);
+      return table;
+    }
+    constexpr std::array<std::int8_t, 256> hex_table    = make_hex_table();
+    constexpr std::array<std::int8_t, 256> base64_table = make_base64_table();
+
+    inline bool is_space(char const& c) noexcept { return static_cast<unsigned char>(c) <= 0x20; }
+
+    std::size_t count_space(std::string_view const& text) noexcept
+    {
+      std::size_t result = 0;
+      std::size_t idx    = 0;
+#if defined(WLIB_BLOB_TEXT_SSE2)
+      __m128i const space = _mm_set1_epi8(0x20);
+      for (; idx + 16 <= text.size(); idx += 16)
+      {
+        __m128i const v = _mm_loadu_si128(reinterpret_cast<__m128i const*>(text.data() + idx));
+        result += static_cast<std::size_t>(std::popcount(static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(v, space), v)))));
+      }
+#endif
+      for (; idx < text.size(); idx++)
+        result += is_space(text[idx]) ? 1 : 0;
+      return result;
+    }
+
+#if defined(WLIB_BLOB_TEXT_SSE2)
+    // unsigned value < limit for every byte
+    inline __m128i below(__m128i const& value, int const& limit) noexcept
+    {
+      return _mm_cmplt_epi8(_mm_xor_si128(value, _mm_set1_epi8(static_cast<char>(0x80))), _mm_set1_epi8(static_cast<char>(0x80 + limit)));
+    }
+
+    inline __m128i hex_digits(__m128i const& nibbles, __m128i const& letters) noexcept
+    {
+      __m128i const is_letter = _mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9));
+      return _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')), _mm_and_si128(is_letter, letters));
+    }
+
+    // 16 hex digits to 8 bytes, false if any character is not a hex digit.
+    inline bool hex_decode_block(char const* src, std::byte* dst) noexcept
+    {
+      __m128i const v      = _mm_loadu_si128(reinterpret_cast<__m128i const*>(src));
+      __m128i const digit  = _mm_sub_epi8(v, _mm_set1_epi8('0'));
+      __m128i const letter = _mm_sub_epi8(_mm_or_si128(v, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+      __m128i const is_digit  = below(digit, 10);
+      __m128i const is_letter = below(letter, 6);
+      if (_mm_movemask_epi8(_mm_or_si128(is_digit, is_letter)) != 0xFFFF)
+        return false;
+
+      __m128i const value = _mm_or_si128(_mm_and_si128(is_digit, digit), _mm_and_si128(is_letter, _mm_add_epi8(letter, _mm_set1_epi8(10))));
+      __m128i const pairs = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(value, _mm_set1_epi16(0x00FF)), 4), _mm_srli_epi16(value, 8));
+      _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_packus_epi16(pairs, pairs));
+      return true;
+    }
+#endif
+
+#if defined(WLIB_BLOB_CPU_SSSE3)
+    // 12 bytes (16 readable) to 16 characters.
+    WLIB_BLOB_SSSE3_TARGET inline void base64_encode_block(std::byte const* src, char* dst) noexcept
+    {
+      __m128i       in = _mm_loadu_si128(reinterpret_cast<__m128i const*>(src));
+      in               = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+      __m128i const t0 = _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0FC0'FC00)), _mm_set1_epi32(0x0400'0040));
+      __m128i const t1 = _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003F'03F0)), _mm_set1_epi32(0x0100'0010));
+      __m128i const indices = _mm_or_si128(t0, t1);
+
+      __m128i       offset = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+      offset               = _mm_or_si128(offset, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), indices), _mm_set1_epi8(13)));
+      __m128i const shift  = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+                                           '/' - 63, 'A', 0, 0);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_add_epi8(_mm_shuffle_epi8(shift, offset), indices));
+    }
+
+    // 16 characters to 12 bytes (16 written), false if any character is outside the alphabet.
+    WLIB_BLOB_SSSE3_TARGET inline bool base64_decode_block(char const* src, std::byte* dst) noexcept
+    {
+      __m128i const v      = _mm_loadu_si128(reinterpret_cast<__m128i const*>(src));
+      __m128i const hi     = _mm_and_si128(_mm_srli_epi32(v, 4), _mm_set1_epi8(0x0F));
+      __m128i const lo     = _mm_and_si128(v, _mm_set1_epi8(0x0F));
+      __m128i const lut_lo = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+      __m128i const lut_hi = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+      if (_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_and_si128(_mm_shuffle_epi8(lut_lo, lo), _mm_shuffle_epi8(lut_hi, hi)), _mm_setzero_si128())) != 0)
+        return false;
+
+      __m128i const lut_roll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+      __m128i const roll     = _mm_shuffle_epi8(lut_roll, _mm_add_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8('/')), hi));
+      __m128i const indices  = _mm_add_epi8(v, roll);
+      __m128i const merged   = _mm_madd_epi16(_mm_maddubs_epi16(indices, _mm_set1_epi32(0x0140'0140)), _mm_set1_epi32(0x0001'1000));
+      __m128i const packed   = _mm_shuffle_epi8(merged, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), packed);
+      return true;
+    }
+
+    // Whole blocks of the encoder, returns the number of bytes consumed.
+    WLIB_BLOB_SSSE3_TARGET std::size_t base64_encode_blocks(char* dst, std::byte const* src, std::size_t const& number_of_bytes) noexcept
+    {
+      std::size_t idx = 0;
+      for (; idx + 16 <= number_of_bytes; idx += 12, dst += 16)
+        base64_encode_block(src + idx, dst);
+      return idx;
+    }
+
+    // Decodes blocks until one holds anything but alphabet characters or input or room run out, returns the number of blocks.
+    WLIB_BLOB_SSSE3_TARGET std::size_t base64_decode_blocks(char const* src, std::size_t const& size, std::byte* dst, std::size_t const& capacity) noexcept
+    {
+      std::size_t blocks = 0;
+      while (((size - 16 * blocks) >= 16) && ((capacity - 12 * blocks) >= 16) && base64_decode_block(src + 16 * blocks, dst + 12 * blocks))
+        blocks++;
+      return blocks;
+    }
+#endif
+  }    // namespace
+
+  namespace hex
+  {
+    std::size_t decoded_size(std::string_view const& text, text_validation validation) noexcept
+    {
+      std::size_t const spaces = (validation == text_validation::lenient) ? count_space(text) : 0;
+      return (text.size() - spaces) / 2;
+    }
+
+    void encode(char* dst, std::byte const* src, std::size_t const& number_of_bytes, letter_case letters) noexcept
+    {
+      char const* const digits = (letters == letter_case::upper) ? hex_upper : hex_lower;
+      std::size_t       idx    = 0;
+#if defined(WLIB_BLOB_TEXT_SSE2)
+      __m128i const mask   = _mm_set1_epi8(0x0F);
+      __m128i const offset = _mm_set1_epi8(static_cast<char>(digits[10] - '0' - 10));
+      for (; idx + 16 <= number_of_bytes; idx += 16)
+      {
+        __m128i const v  = _mm_loadu_si128(reinterpret_cast<__m128i const*>(src + idx));
+        __m128i const hi = _mm_and_si128(_mm_srli_epi16(v, 4), mask);
+        __m128i const lo = _mm_and_si128(v, mask);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 2 * idx), hex_digits(_mm_unpacklo_epi8(hi, lo), offset));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 2 * idx + 16), hex_digits(_mm_unpackhi_epi8(hi, lo), offset));
+      }
+#endif
+      for (; idx < number_of_bytes; idx++)
+      {
+        std::uint8_t const value = static_cast<std::uint8_t>(src[idx]);
+        dst[2 * idx]             = digits[value >> 4];
+        dst[2 * idx + 1]         = digits[value & 0x0F];
+      }
+    }
+
+    bool decode(std::byte* dst, std::size_t const& capacity, std::string_view const& text, text_validation validation, std::size_t& number_of_bytes) noexcept
+    {
+      char const*       ip      = text.data();
+      char const* const end     = ip + text.size();
+      std::size_t       op      = 0;
+      int               pending = -1;
+#if defined(WLIB_BLOB_TEXT_SSE2)
+      char const* scalar_until = ip;
+#endif
+      while (ip != end)
+      {
+#if defined(WLIB_BLOB_TEXT_SSE2)
+        // Whole blocks of digits take the vector path, a block with anything else is done byte by byte.
+        if ((pending < 0) && (ip >= scalar_until) && ((end - ip) >= 16) && ((capacity - op) >= 8))
+        {
+          if (hex_decode_block(ip, dst + op))
+          {
+            ip += 16;
+            op += 8;
+            continue;
+          }
+          scalar_until = ip + 16;
+        }
+#endif
+        char const        c     = *ip++;
+        std::int8_t const value = hex_table[static_cast<std::uint8_t>(c)];
+        if (value < 0)
+        {
+          if ((validation == text_validation::lenient) && is_space(c))
+            continue;
+          return false;
+        }
+        if (pending < 0)
+        {
+          pending = value;
+          continue;
+        }
+        if (op == capacity)
+          return false;
+        dst[op++] = static_cast<std::byte>((pending << 4) | value);
+        pending   = -1;
+      }
+      if (pending >= 0)
+        return false;
+      number_of_bytes = op;
+      return true;
+    }
+  }    // namespace hex
+
+  namespace base64
+  {
+    std::size_t decoded_size(std::string_view const& text, text_validation validation) noexcept
+    {
+      bool const  lenient = (validation == text_validation::lenient);
+      std::size_t chars   = text.size() - (lenient ? count_space(text) : 0);
+      for (std::size_t idx = text.size(); idx != 0; idx--)
+      {
+        if (text[idx - 1] == '=')
+          chars--;
+        else if (!lenient || !is_space(text[idx - 1]))
+          break;
+      }
+      return chars * 3 / 4;
+    }
+
+    void encode(char* dst, std::byte const* src, std::size_t const& number_of_bytes) noexcept
+    {
+      std::size_t idx = 0;
+      char*       op  = dst;
+#if defined(WLIB_BLOB_CPU_SSSE3)
+      if (cpu::has_ssse3())
+      {
+        idx = base64_encode_blocks(op, src, number_of_bytes);
+        op += idx / 3 * 4;
+      }
+#endif
+      for (; idx + 3 <= number_of_bytes; idx += 3)
+      {
+        std::uint32_t const value = (static_cast<std::uint32_t>(src[idx]) << 16) | (static_cast<std::uint32_t>(src[idx + 1]) << 8) | static_cast<std::uint32_t>(src[idx + 2]);
+        *op++                     = alphabet[(value >> 18) & 0x3F];
+        *op++                     = alphabet[(value >> 12) & 0x3F];
+        *op++                     = alphabet[(value >> 6) & 0x3F];
+        *op++                     = alphabet[value & 0x3F];
+      }
+      if (idx != number_of_bytes)
+      {
+        bool const          two   = (number_of_bytes - idx) == 2;
+        std::uint32_t const value = (static_cast<std::uint32_t>(src[idx]) << 16) | (two ? (static_cast<std::uint32_t>(src[idx + 1]) << 8) : 0);
+        *op++                     = alphabet[(value >> 18) & 0x3F];
+        *op++                     = alphabet[(value >> 12) & 0x3F];
+        *op++                     = two ? alphabet[(value >> 6) & 0x3F] : '=';
+        *op++                     = '=';
+      }
+    }
+
+    bool decode(std::byte* dst, std::size_t const& capacity, std::string_view const& text, text_validation validation, std::size_t& number_of_bytes) noexcept
+    {
+      bool const        lenient = (validation == text_validation::lenient);
+      char const*       ip      = text.data();
+      char const* const end     = ip + text.size();
+      std::size_t       op      = 0;
+      std::uint32_t     acc     = 0;
+      std::size_t       count   = 0;    // characters of the current quad
+      bool              padded  = false;
+#if defined(WLIB_BLOB_CPU_SSSE3)
+      bool const  vectorised   = cpu::has_ssse3();
+      char const* scalar_until = ip;
+#endif
+      while (ip != end)
+      {
+#if defined(WLIB_BLOB_CPU_SSSE3)
+        // The block after a vectorised run did not decode, it is done byte by byte.
+        if (vectorised && (count == 0) && (ip >= scalar_until) && ((end - ip) >= 16) && ((capacity - op) >= 16))
+        {
+          std::size_t const blocks = base64_decode_blocks(ip, static_cast<std::size_t>(end - ip), dst + op, capacity - op);
+          ip += 16 * blocks;
+          op += 12 * blocks;
+          scalar_until = ip + 16;
+          if (blocks != 0)
+            continue;
+        }
+#endif
+        char const c = *ip++;
+        if (c == '=')
+        {
+          padded = true;
+          break;
+        }
+        std::int8_t const value = base64_table[static_cast<std::uint8_t>(c)];
+        if (value < 0)
+        {
+          if (lenient && is_space(c))
+            continue;
+          return false;
+        }
+        acc = (acc << 6) | static_cast<std::uint32_t>(value);
+        if (++count == 4)
+        {
+          if ((capacity - op) < 3)
+            return false;
+          dst[op++] = static_cast<std::byte>(acc >> 16);
+          dst[op++] = static_cast<std::byte>(acc >> 8);
+          dst[op++] = static_cast<std::byte>(acc);
+          acc       = 0;
+          count     = 0;
+        }
+      }
+
+      // The padding completes the last quad, after it only more padding or (lenient) whitespace may follow.
+      if (padded)
+      {
+        std::size_t pads = 1;
+        for (; ip != end; ip++)
+        {
+          if (*ip == '=')
+            pads++;
+          else if (!lenient || !is_space(*ip))
+            return false;
+        }
+        if ((count < 2) || (lenient ? ((count + pads) > 4) : ((count + pads) != 4)))
+          return false;
+      }
+      else if ((count == 1) || ((count != 0) && !lenient))
+      {
+        return false;
+      }
+
+      if (count != 0)
+      {
+        std::size_t const bytes = count - 1;
+        std::size_t const spare = count * 6 - bytes * 8;
+        if (!lenient && ((acc & ((1U << spare) - 1)) != 0))
+          return false;
+        if ((capacity - op) < bytes)
+          return false;
+        acc >>= spare;
+        for (std::size_t idx = bytes; idx != 0; idx--)
+          dst[op++] = static_cast<std::byte>(acc >> (8 * (idx - 1)));
+      }
+      number_of_bytes = op;
+      return true;
+    }
+  }    // namespace base64
+}    // namespace wlib::blob
@@ -0,0 +1,130 @@
+#include <wlib-BLOB_Varint.hpp>
+
+//
+#include "wlib-BLOB_Cpu.hpp"
+
+namespace wlib::blob::varint
+{
+  namespace
+  {
+#if defined(WLIB_BLOB_CPU_SSSE3)
+    constexpr std::size_t block_size = 8;
+
+    // For every continuation mask of an 8 byte block: the leading varints of at most two
+    // bytes and a shuffle moving each of them into its own 16 bit lane.
+    struct block_entry
+    {
+      uint8_t number_of_values = 0;
+      uint8_t number_of_bytes  = 0;
+      uint8_t shuffle[16]{};
+    };
+
+    constexpr std::array<block_entry, 256> make_block_table() noexcept
+    {
+      std::array<block_entry, 256> table{};
+      for (std::size_t mask = 0; mask < table.size(); mask++)
+      {
+        block_entry& entry = table[mask];
+        for (uint8_t& idx : entry.shuffle)
+          idx = 0x80;
+
+        std::size_t pos = 0;
+        while (pos < block_size)
+        {
+          std::size_t length = 0;
+          if ((mask & (1U << pos)) == 0)
+            length = 1;
+          else if (((pos + 1) < block_size) && ((mask & (1U << (pos + 1))) == 0))
+            length = 2;
+          else
+            break;
+
+          entry.shuffle[2 * entry.number_of_values]     = static_cast<uint8_t>(pos);
+          entry.shuffle[2 * entry.number_of_values + 1] = (length == 2) ? static_cast<uint8_t>(pos + 1) : 0x80;
+          entry.number_of_values++;
+          pos += length;
+        }
+        entry.number_of_bytes = static_cast<uint8_t>(pos);
+      }
+      return table;
+    }
+
+    alignas(16) constexpr std::array<block_entry, 256> block_table = make_block_table();
+
+    // Decodes the leading short varints of src into 8 lanes of dst, dst and src need room for 8 entries.
+    template <typename T> WLIB_BLOB_SSSE3_TARGET std::size_t decode_block(std::byte const* src, T* dst, std::size_t& number_of_values) noexcept
+    {
+      __m128i const     raw   = _mm_loadl_epi64(reinterpret_cast<__m128i const*>(src));
+      block_entry const& entry = block_table[static_cast<std::size_t>(_mm_movemask_epi8(raw) & 0xFF)];
+
+      __m128i const lanes  = _mm_shuffle_epi8(raw, _mm_loadu_si128(reinterpret_cast<__m128i const*>(entry.shuffle)));
+      __m128i const low    = _mm_and_si128(lanes, _mm_set1_epi16(0x007F));
+      __m128i const high   = _mm_srli_epi16(_mm_and_si128(lanes, _mm_set1_epi16(0x7F00)), 1);
+      __m128i const values = _mm_or_si128(low, high);
+
+      __m128i const zero = _mm_setzero_si128();
+      __m128i const lo32 = _mm_unpacklo_epi16(values, zero);
+      __m128i const hi32 = _mm_unpackhi_epi16(values, zero);
+      if constexpr (sizeof(T) == 4)
+      {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), lo32);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 4), hi32);
+      }
+      else
+      {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_unpacklo_epi32(lo32, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 2), _mm_unpackhi_epi32(lo32, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 4), _mm_unpacklo_epi32(hi32, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 6), _mm_unpackhi_epi32(hi32, zero));
+      }
+
+      number_of_values = entry.number_of_values;
+      return entry.number_of_bytes;
+    }
+
+    // Block loop of decode_bulk, false on a malformed varint.
+    template <typename T>
+    WLIB_BLOB_SSSE3_TARGET bool decode_blocks(std::byte const* src, std::size_t const& size, std::span<T> const& values, std::size_t& idx, std::size_t& value_idx) noexcept
+    {
+      while (((size - idx) >= block_size) && ((values.size() - value_idx) >= block_size))
+      {
+        std::size_t number_of_values = 0;
+        std::size_t number_of_bytes  = decode_block(&src[idx], &values[value_idx], number_of_values);
+        if (number_of_values == 0)
+        {
+          number_of_bytes  = varint::decode(&src[idx], size - idx, values[value_idx]);
+          number_of_values = 1;
+          if (number_of_bytes == 0)
+            return false;
+        }
+        idx += number_of_bytes;
+        value_idx += number_of_values;
+      }
+      return true;
+    }
+#endif
+
+    template <typename T> std::size_t decode_bulk(std::byte const* src, std::size_t const& size, std::span<T> const& values) noexcept
+    {
+      std::size_t idx       = 0;
+      std::size_t value_idx = 0;
+
+#if defined(WLIB_BLOB_CPU_SSSE3)
+      if (cpu::has_ssse3() && !decode_blocks(src, size, values, idx, value_idx))
+        return 0;
+#endif
+
+      for (; value_idx < values.size(); value_idx++)
+      {
+        std::size_t const ret = varint::decode(&src[idx], size - idx, values[value_idx]);
+        if (ret == 0)
+          return 0;
+        idx += ret;
+      }
+      return idx;
+    }
+  }    // namespace
+
+  std::size_t decode(std::byte const* src, std::size_t const& size, std::span<uint32_t> const& values) noexcept { return decode_bulk(src, size, values); }
+  std::size_t decode(std::byte const* src, std::size_t const& size, std::span<uint64_t> const& values) noexcept { return decode_bulk(src, size, values); }
+}    // namespace wlib::blob::varint
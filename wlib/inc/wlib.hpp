@@ -4,6 +4,23 @@
 
 #include <wlib-CRC.hpp>
 #include <wlib-BLOB.hpp>
+#include <wlib-BLOB_Segmented.hpp>
+#include <wlib-BLOB_Varint.hpp>
+#include <wlib-BLOB_Bits.hpp>
+#include <wlib-BLOB_Layout.hpp>
+#include <wlib-BLOB_Serialize.hpp>
+#include <wlib-BLOB_File.hpp>
+#include <wlib-BLOB_IO.hpp>
+#include <wlib-BLOB_Pool.hpp>
+#include <wlib-BLOB_Ring.hpp>
+#include <wlib-BLOB_Search.hpp>
+#include <wlib-BLOB_Stuffing.hpp>
+#include <wlib-BLOB_Frame.hpp>
+#include <wlib-BLOB_LZ.hpp>
+#include <wlib-BLOB_Delta.hpp>
+#include <wlib-BLOB_Text.hpp>
+#include <wlib-BLOB_Snapshot.hpp>
+#include <wlib-BLOB_Batch.hpp>
 #include <wlib-Callback.hpp>
 #include <wlib-Publisher.hpp>
 